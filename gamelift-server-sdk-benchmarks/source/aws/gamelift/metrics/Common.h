@@ -0,0 +1,106 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/metrics/DerivedMetric.h>
+#include <aws/gamelift/metrics/IMetricsProcessor.h>
+#include <aws/gamelift/metrics/InternalTypes.h>
+#include <aws/gamelift/metrics/MetricsSettings.h>
+#include <aws/gamelift/metrics/Samplers.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Gauge with a runtime key and a fixed set of derived metrics, so benchmarks
+ * can create as many metrics as they need.
+ */
+template <class DerivedMetricsT>
+class BenchmarkGauge : public Aws::GameLift::Metrics::IMetric {
+public:
+  BenchmarkGauge(std::string Key, DerivedMetricsT &&DerivedMetrics)
+      : Aws::GameLift::Metrics::IMetric(DerivedMetricsT::Size > 0),
+        Key(std::move(Key)), DerivedMetrics(std::move(DerivedMetrics)) {}
+
+  virtual Aws::GameLift::Metrics::MetricType GetMetricType() const override {
+    return Aws::GameLift::Metrics::MetricType::Gauge;
+  }
+  virtual const char *GetKey() const override { return Key.c_str(); }
+  virtual Aws::GameLift::Metrics::IDerivedMetricCollection &
+  GetDerivedMetrics() override {
+    return DerivedMetrics;
+  }
+  virtual Aws::GameLift::Metrics::ISampler &GetSampler() override {
+    return Sampler;
+  }
+
+private:
+  std::string Key;
+  Aws::GameLift::Metrics::SampleAll Sampler;
+  DerivedMetricsT DerivedMetrics;
+};
+
+template <class DerivedMetricsT>
+std::unique_ptr<Aws::GameLift::Metrics::IMetric>
+MakeBenchmarkGauge(std::string Key, DerivedMetricsT &&DerivedMetrics) {
+  return std::unique_ptr<Aws::GameLift::Metrics::IMetric>(
+      new BenchmarkGauge<DerivedMetricsT>(
+          std::move(Key), std::forward<DerivedMetricsT>(DerivedMetrics)));
+}
+
+/**
+ * Counts the packets and bytes handed to SendPacketCallback instead of
+ * sending them.
+ */
+struct CapturedPackets {
+  uint64_t Packets = 0;
+  uint64_t Bytes = 0;
+
+  Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc MakeCallback() {
+    return [this](const char *Packet, int Size) {
+      (void)Packet;
+      ++Packets;
+      Bytes += static_cast<uint64_t>(Size);
+    };
+  }
+};
+
+/**
+ * Discards everything derived metrics emit.
+ */
+struct NullEnqueuer : public Aws::GameLift::Metrics::IMetricsEnqueuer {
+  uint64_t Messages = 0;
+
+  virtual void
+  Enqueue(Aws::GameLift::Metrics::MetricMessage Message) override {
+    (void)Message;
+    ++Messages;
+  }
+};
+
+/**
+ * Same sample values on every run, so results are comparable between runs.
+ */
+inline std::vector<double> MakeSampleValues(size_t Count) {
+  std::mt19937 Generator(12345);
+  std::lognormal_distribution<double> Distribution(3.0, 1.0);
+
+  std::vector<double> Values(Count);
+  for (double &Value : Values) {
+    Value = Distribution(Generator);
+  }
+  return Values;
+}
@@ -0,0 +1,154 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <aws/gamelift/metrics/Histogram.h>
+#include <aws/gamelift/metrics/MetricsProcessor.h>
+#include <aws/gamelift/metrics/Percentiles.h>
+#include <aws/gamelift/metrics/Summary.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Aws::GameLift::Metrics;
+
+namespace {
+// Enqueue never drains the queue, so the iteration count is fixed to bound
+// the memory the queued messages take.
+constexpr int EnqueueIterations = 1 << 19;
+
+// Samples each metric receives per capture in BM_ProcessMetricsNow.
+constexpr int SamplesPerCapture = 4;
+
+std::unique_ptr<MetricsProcessor> Processor;
+std::unique_ptr<IMetric> EnqueuedGauge;
+std::unique_ptr<IMetric> EnqueuedCounter;
+
+std::unique_ptr<IMetric> MakeGauge(std::string Key, int DerivedMetricCount) {
+  switch (DerivedMetricCount) {
+  case 0:
+    return MakeBenchmarkGauge(std::move(Key), CollectDerivedMetrics());
+  case 1:
+    return MakeBenchmarkGauge(std::move(Key),
+                              CollectDerivedMetrics(Percentiles(0.5, 0.95)));
+  case 2:
+    return MakeBenchmarkGauge(
+        std::move(Key),
+        CollectDerivedMetrics(Percentiles(0.5, 0.95), Summary()));
+  default:
+    return MakeBenchmarkGauge(
+        std::move(Key),
+        CollectDerivedMetrics(Percentiles(0.5, 0.95), Summary(),
+                              ExponentialHistogram(1, 2, 10)));
+  }
+}
+} // namespace
+
+/**
+ * Throughput of Enqueue from state.threads() game threads logging into one
+ * processor. Arg 0 enables ThreadLocalAggregation.
+ */
+static void BM_Enqueue(benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    MetricsSettings Settings;
+    Settings.CaptureIntervalSec = 0;
+    Settings.ThreadLocalAggregation = state.range(0) != 0;
+    Processor.reset(new MetricsProcessor(Settings));
+    EnqueuedGauge = MakeGauge("bench_enqueue_gauge", 0);
+    EnqueuedCounter = MakeGauge("bench_enqueue_counter", 0);
+  }
+
+  double Value = 0;
+  for (auto _ : state) {
+    Processor->Enqueue(MetricMessage::GaugeSet(*EnqueuedGauge, Value));
+    Processor->Enqueue(MetricMessage::CounterAdd(*EnqueuedCounter, 1));
+    Value += 1;
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+
+  if (state.thread_index() == 0) {
+    Processor.reset();
+    EnqueuedGauge.reset();
+    EnqueuedCounter.reset();
+  }
+}
+BENCHMARK(BM_Enqueue)
+    ->ArgName("ThreadLocalAggregation")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 8)
+    ->Iterations(EnqueueIterations)
+    ->UseRealTime();
+
+/**
+ * Latency of ProcessMetricsNow for a capture period in which every metric got
+ * SamplesPerCapture samples.
+ *
+ * Args: number of metrics, per-metric tags, derived metrics per metric (0-3).
+ */
+static void BM_ProcessMetricsNow(benchmark::State &state) {
+  const int MetricCount = static_cast<int>(state.range(0));
+  const int TagCount = static_cast<int>(state.range(1));
+  const int DerivedMetricCount = static_cast<int>(state.range(2));
+
+  CapturedPackets Captured;
+  MetricsSettings Settings;
+  Settings.SendPacketCallback = Captured.MakeCallback();
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor BenchmarkProcessor(Settings);
+  BenchmarkProcessor.SetGlobalTag("gamelift_process_id", "benchmark");
+
+  std::vector<std::unique_ptr<IMetric>> Metrics;
+  Metrics.reserve(MetricCount);
+  for (int I = 0; I < MetricCount; ++I) {
+    Metrics.emplace_back(
+        MakeGauge("bench_gauge_" + std::to_string(I), DerivedMetricCount));
+    for (int Tag = 0; Tag < TagCount; ++Tag) {
+      const std::string Key = "tag_" + std::to_string(Tag);
+      const std::string TagValue = "value_" + std::to_string(Tag);
+      BenchmarkProcessor.Enqueue(MetricMessage::TagSet(
+          *Metrics.back(), Key.c_str(), TagValue.c_str()));
+    }
+  }
+
+  const std::vector<double> Values = MakeSampleValues(SamplesPerCapture);
+  auto EnqueueSamples = [&]() {
+    for (const std::unique_ptr<IMetric> &Metric : Metrics) {
+      for (double Value : Values) {
+        BenchmarkProcessor.Enqueue(MetricMessage::GaugeSet(*Metric, Value));
+      }
+    }
+  };
+
+  // Run one capture before timing starts, so the processor has already seen
+  // the tags and every metric the derived metrics emit.
+  EnqueueSamples();
+  BenchmarkProcessor.ProcessMetricsNow();
+
+  Captured.Bytes = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    EnqueueSamples();
+    state.ResumeTiming();
+
+    BenchmarkProcessor.ProcessMetricsNow();
+  }
+  state.SetItemsProcessed(state.iterations() * MetricCount * SamplesPerCapture);
+  state.SetBytesProcessed(static_cast<int64_t>(Captured.Bytes));
+}
+BENCHMARK(BM_ProcessMetricsNow)
+    ->ArgNames({"Metrics", "Tags", "DerivedMetrics"})
+    ->ArgsProduct({{16, 256, 4096}, {0, 4}, {0, 1, 2, 3}})
+    ->Unit(benchmark::kMicrosecond);
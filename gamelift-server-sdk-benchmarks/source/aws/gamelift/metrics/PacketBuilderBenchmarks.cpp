@@ -0,0 +1,98 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <aws/gamelift/metrics/PacketBuilder.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Aws::GameLift::Metrics;
+
+namespace {
+constexpr int PacketSizeBytes = 1472;
+
+PacketBuilder::TagMap MakeTags(int TagCount) {
+  PacketBuilder::TagMap Tags;
+  for (int Tag = 0; Tag < TagCount; ++Tag) {
+    Tags.emplace("tag_" + std::to_string(Tag), "value_" + std::to_string(Tag));
+  }
+  return Tags;
+}
+} // namespace
+
+/**
+ * Append with tags already rendered, as MetricsProcessor calls it. Bytes are
+ * the packet bytes handed to SendPacketCallback.
+ *
+ * Arg 0: per-metric tags.
+ */
+static void BM_PacketBuilderAppend(benchmark::State &state) {
+  std::unique_ptr<IMetric> Gauge =
+      MakeBenchmarkGauge("bench_packet_gauge", CollectDerivedMetrics());
+  const std::string TagSuffix =
+      RenderTagSuffix(MakeTags(1), MakeTags(static_cast<int>(state.range(0))));
+  const std::vector<double> Values = MakeSampleValues(1024);
+
+  CapturedPackets Captured;
+  MetricsSettings::SendPacketFunc SendPacket = Captured.MakeCallback();
+  PacketBuilder Builder(PacketSizeBytes);
+
+  size_t ValueIndex = 0;
+  for (auto _ : state) {
+    Builder.Append(MetricMessage::GaugeSet(*Gauge, Values[ValueIndex]),
+                   TagSuffix, SendPacket);
+    ValueIndex = (ValueIndex + 1) % Values.size();
+  }
+  Builder.Flush(SendPacket);
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(static_cast<int64_t>(Captured.Bytes));
+}
+BENCHMARK(BM_PacketBuilderAppend)->ArgName("Tags")->Arg(0)->Arg(4)->Arg(16);
+
+/**
+ * Append rendering the global and per-metric tags on every call.
+ *
+ * Arg 0: per-metric tags.
+ */
+static void BM_PacketBuilderAppendTagMaps(benchmark::State &state) {
+  std::unique_ptr<IMetric> Gauge =
+      MakeBenchmarkGauge("bench_packet_gauge", CollectDerivedMetrics());
+  const PacketBuilder::TagMap GlobalTags = MakeTags(1);
+  const PacketBuilder::TagMap MetricTags =
+      MakeTags(static_cast<int>(state.range(0)));
+  const std::vector<double> Values = MakeSampleValues(1024);
+
+  CapturedPackets Captured;
+  MetricsSettings::SendPacketFunc SendPacket = Captured.MakeCallback();
+  PacketBuilder Builder(PacketSizeBytes);
+
+  size_t ValueIndex = 0;
+  for (auto _ : state) {
+    Builder.Append(MetricMessage::GaugeSet(*Gauge, Values[ValueIndex]),
+                   GlobalTags, MetricTags, SendPacket);
+    ValueIndex = (ValueIndex + 1) % Values.size();
+  }
+  Builder.Flush(SendPacket);
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(static_cast<int64_t>(Captured.Bytes));
+}
+BENCHMARK(BM_PacketBuilderAppendTagMaps)
+    ->ArgName("Tags")
+    ->Arg(0)
+    ->Arg(4)
+    ->Arg(16);
@@ -0,0 +1,67 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "Common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <aws/gamelift/metrics/Percentiles.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Aws::GameLift::Metrics;
+
+namespace {
+/**
+ * Handles state.range(0) samples and emits the percentiles once per
+ * iteration, which is what one capture period costs a metric with
+ * percentiles.
+ */
+void RunPercentiles(benchmark::State &state, IDerivedMetric &Percentiles) {
+  std::unique_ptr<IMetric> Gauge =
+      MakeBenchmarkGauge("bench_percentiles_gauge", CollectDerivedMetrics());
+  const std::vector<double> Values =
+      MakeSampleValues(static_cast<size_t>(state.range(0)));
+
+  NullEnqueuer Results;
+  for (auto _ : state) {
+    for (double Value : Values) {
+      MetricMessage Message = MetricMessage::GaugeSet(*Gauge, Value);
+      Percentiles.HandleMessage(Message, Results);
+    }
+    Percentiles.EmitMetrics(Gauge.get(), Results);
+  }
+  benchmark::DoNotOptimize(Results.Messages);
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+} // namespace
+
+static void BM_Percentiles(benchmark::State &state) {
+  auto Percentiles = Aws::GameLift::Metrics::Percentiles(0.5, 0.95, 0.99);
+  RunPercentiles(state, Percentiles);
+}
+BENCHMARK(BM_Percentiles)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18)
+    ->Complexity(benchmark::oNLogN);
+
+static void BM_ApproximatePercentiles(benchmark::State &state) {
+  auto Percentiles =
+      Aws::GameLift::Metrics::ApproximatePercentiles(0.5, 0.95, 0.99);
+  RunPercentiles(state, Percentiles);
+}
+BENCHMARK(BM_ApproximatePercentiles)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18)
+    ->Complexity(benchmark::oN);
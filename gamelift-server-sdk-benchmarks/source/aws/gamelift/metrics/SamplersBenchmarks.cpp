@@ -0,0 +1,48 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <benchmark/benchmark.h>
+
+#include <aws/gamelift/metrics/Samplers.h>
+
+using namespace Aws::GameLift::Metrics;
+
+namespace {
+/**
+ * Asks the sampler about one sample per iteration from every thread, which is
+ * what sampling costs a metric logged once per packet.
+ */
+void RunSampler(benchmark::State &state, ISampler &Sampler) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Sampler.ShouldTakeSample());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+SampleFraction FractionSampler(0.1f, 12345);
+SampleEveryN EveryNSampler(10);
+SampleAdaptive AdaptiveSampler(1000, 12345);
+} // namespace
+
+static void BM_SampleFraction(benchmark::State &state) {
+  RunSampler(state, FractionSampler);
+}
+BENCHMARK(BM_SampleFraction)->ThreadRange(1, 8);
+
+static void BM_SampleEveryN(benchmark::State &state) {
+  RunSampler(state, EveryNSampler);
+}
+BENCHMARK(BM_SampleEveryN)->ThreadRange(1, 8);
+
+static void BM_SampleAdaptive(benchmark::State &state) {
+  RunSampler(state, AdaptiveSampler);
+}
+BENCHMARK(BM_SampleAdaptive)->ThreadRange(1, 8);
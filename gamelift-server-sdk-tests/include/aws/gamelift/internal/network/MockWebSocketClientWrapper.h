@@ -26,7 +26,7 @@ namespace Internal {
         MOCK_METHOD(GenericOutcome, SendSocketMessage, (const std::string& requestId, const std::string& message), (override));
         MOCK_METHOD(void, Disconnect, (), (override));
         MOCK_METHOD(void, RegisterGameLiftCallback,
-                (const std::string& gameLiftEvent, const std::function<GenericOutcome(std::string)>& callback),
+                (const std::string& gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value&)>& callback),
                 (override));
         MOCK_METHOD(bool, IsConnected, (), (override));
     };
@@ -26,10 +26,14 @@
 #include <aws/gamelift/internal/network/MockWebSocketClientWrapper.h>
 #include <aws/gamelift/server/model/Player.h>
 #include <aws/gamelift/server/model/ServerParameters.h>
+#include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
 #include <rapidjson/document.h>
 #include <rapidjson/rapidjson.h>
+#include <thread>
+#include <vector>
 
 using namespace Aws::GameLift;
 
@@ -38,6 +42,35 @@ namespace GameLift {
 namespace Internal {
 namespace Test {
 
+#ifndef GAMELIFT_USE_STD
+namespace {
+void RunCallbackTaskInline(Aws::GameLift::Server::CallbackTaskFn task, void *taskState, void *executorState) {
+    (*static_cast<int *>(executorState))++;
+    task(taskState);
+}
+
+void RecordGameSessionId(Aws::GameLift::Server::Model::GameSession gameSession, void *state) {
+    *static_cast<std::string *>(state) = gameSession.GetGameSessionId();
+}
+} // namespace
+#endif
+
+namespace {
+struct BlockingHealthCheck {
+    std::atomic<int> calls;
+    std::shared_future<void> release;
+};
+
+bool RunBlockingHealthCheck(void *state) {
+    BlockingHealthCheck *healthCheck = static_cast<BlockingHealthCheck *>(state);
+    healthCheck->calls++;
+    // The test may have returned by the time this wakes up, so don't touch healthCheck afterwards.
+    std::shared_future<void> release = healthCheck->release;
+    release.wait();
+    return true;
+}
+} // namespace
+
 class GameLiftServerStateTest : public ::testing::Test {
 protected:
     const char *websocketUrl = "wss://n1myab2jn9.execute-api.us-west-2.amazonaws.com/alpha";
@@ -290,6 +323,78 @@ TEST_F(GameLiftServerStateTest, GIVEN_processNotReady_WHEN_acceptPlayerSession_T
     EXPECT_EQ(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED), outcome.GetError());
 }
 
+TEST_F(GameLiftServerStateTest, GIVEN_connectedWebSocketClient_WHEN_acceptPlayerSessionAsync_THEN_success) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("AcceptPlayerSession")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    std::string playerSessionId = "playerSessionId";
+    std::promise<GenericOutcome> outcomePromise;
+    std::future<GenericOutcome> outcomeFuture = outcomePromise.get_future();
+
+    // WHEN
+    CallProcessReady();
+    serverState->OnStartGameSession(gameSession);
+    serverState->AcceptPlayerSessionAsync(playerSessionId, [&outcomePromise](const GenericOutcome &outcome) { outcomePromise.set_value(outcome); });
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, outcomeFuture.wait_for(std::chrono::seconds(5)));
+    ASSERT_TRUE(outcomeFuture.get().IsSuccess());
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_callbackExecutor_WHEN_onStartGameSession_THEN_callbackRunsOnExecutor) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    int executedTasks = 0;
+    std::string startedGameSessionId;
+#ifdef GAMELIFT_USE_STD
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        [&startedGameSessionId](Aws::GameLift::Server::Model::GameSession startedGameSession) { startedGameSessionId = startedGameSession.GetGameSessionId(); },
+        nullptr, nullptr, 1001, Aws::GameLift::Server::LogParameters());
+    processParams.setCallbackExecutor([&executedTasks](const std::function<void()> &task) {
+        executedTasks++;
+        task();
+    });
+#else
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        &RecordGameSessionId, &startedGameSessionId, nullptr, nullptr, nullptr, nullptr, 1001, Aws::GameLift::Server::LogParameters());
+    processParams.setCallbackExecutor(&RunCallbackTaskInline, &executedTasks);
+#endif
+
+    // WHEN
+    serverState->ProcessReady(processParams);
+    serverState->OnStartGameSession(gameSession);
+
+    // THEN
+    EXPECT_EQ(1, executedTasks);
+    EXPECT_EQ("gameSessionId", startedGameSessionId);
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_processNotReady_WHEN_acceptPlayerSessionAsync_THEN_fail) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("AcceptPlayerSession"))).Times(0);
+    std::string playerSessionId = "playerSessionId";
+    std::promise<GenericOutcome> outcomePromise;
+    std::future<GenericOutcome> outcomeFuture = outcomePromise.get_future();
+
+    // WHEN
+    serverState->AcceptPlayerSessionAsync(playerSessionId, [&outcomePromise](const GenericOutcome &outcome) { outcomePromise.set_value(outcome); });
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, outcomeFuture.wait_for(std::chrono::seconds(5)));
+    GenericOutcome outcome = outcomeFuture.get();
+    ASSERT_FALSE(outcome.IsSuccess());
+    EXPECT_EQ(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED), outcome.GetError());
+}
+
 TEST_F(GameLiftServerStateTest, GIVEN_connectedWebSocketClient_WHEN_updatePlayerSessionCreationPolicy_THEN_success) {
     // GIVEN
     EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
@@ -462,6 +567,81 @@ TEST_F(GameLiftServerStateTest, GIVEN_wait71Seconds_WHEN_processReady_THEN_repor
     EXPECT_EQ("HeartbeatServerProcess", (std::string)processHealth2Json["Action"].GetString());
 }
 
+TEST_F(GameLiftServerStateTest, GIVEN_unhealthyHealthCheckCallback_WHEN_processReady_THEN_reportsUnhealthy) {
+    // GIVEN
+    MessageCaptorAsync processHealth;
+
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillOnce(testing::Invoke(&processHealth, &MessageCaptorAsync::SendSocketMessage));
+#ifdef GAMELIFT_USE_STD
+    Aws::GameLift::Server::ProcessParameters processParams =
+        Aws::GameLift::Server::ProcessParameters(nullptr, nullptr, [] { return false; }, 1001, Aws::GameLift::Server::LogParameters());
+#else
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        nullptr, nullptr, nullptr, nullptr, [](void *) { return false; }, nullptr, 1001, Aws::GameLift::Server::LogParameters());
+#endif
+
+    // WHEN
+    GenericOutcome outcome = serverState->ProcessReady(processParams);
+
+    // THEN
+    rapidjson::Document processHealthJson;
+    std::future<std::string> processHealthFuture = processHealth.received_message.get_future();
+    EXPECT_TRUE(outcome.IsSuccess());
+    // The callback runs on the callback executor and the heartbeat is sent from the task scheduler.
+    ASSERT_EQ(std::future_status::ready, processHealthFuture.wait_for(std::chrono::milliseconds(200)));
+    processHealthJson.Parse(processHealthFuture.get().c_str());
+    EXPECT_EQ("HeartbeatServerProcess", (std::string)processHealthJson["Action"].GetString());
+    EXPECT_FALSE(processHealthJson["HealthStatus"].GetBool());
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_healthCheckCallbackStillRunning_WHEN_nextHealthCheck_THEN_reportsUnhealthyWithoutCallingAgain) {
+    // GIVEN
+    MessageCaptorAsync processHealth1;
+    MessageCaptorAsync processHealth2;
+    std::promise<void> releaseHealthCheck;
+    BlockingHealthCheck healthCheck;
+    healthCheck.calls = 0;
+    healthCheck.release = releaseHealthCheck.get_future().share();
+
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillOnce(testing::Invoke(&processHealth1, &MessageCaptorAsync::SendSocketMessage))
+        .WillOnce(testing::Invoke(&processHealth2, &MessageCaptorAsync::SendSocketMessage))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+#ifdef GAMELIFT_USE_STD
+    BlockingHealthCheck *healthCheckState = &healthCheck;
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        nullptr, nullptr, [healthCheckState] { return RunBlockingHealthCheck(healthCheckState); }, 1001, Aws::GameLift::Server::LogParameters());
+#else
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        nullptr, nullptr, nullptr, nullptr, &RunBlockingHealthCheck, &healthCheck, 1001, Aws::GameLift::Server::LogParameters());
+#endif
+
+    // WHEN
+    GenericOutcome outcome = serverState->ProcessReady(processParams);
+
+    // THEN
+    EXPECT_TRUE(outcome.IsSuccess());
+    // The first beat times out, the second finds the callback still running. Both report unhealthy.
+    std::future<std::string> processHealth1Future = processHealth1.received_message.get_future();
+    std::future<std::string> processHealth2Future = processHealth2.received_message.get_future();
+    ASSERT_EQ(std::future_status::ready, processHealth2Future.wait_for(std::chrono::milliseconds(71000)));
+    rapidjson::Document processHealth1Json;
+    rapidjson::Document processHealth2Json;
+    processHealth1Json.Parse(processHealth1Future.get().c_str());
+    processHealth2Json.Parse(processHealth2Future.get().c_str());
+    EXPECT_FALSE(processHealth1Json["HealthStatus"].GetBool());
+    EXPECT_FALSE(processHealth2Json["HealthStatus"].GetBool());
+    EXPECT_EQ(1, healthCheck.calls.load());
+    releaseHealthCheck.set_value();
+}
+
 TEST_F(GameLiftServerStateTest, GIVEN_validStopMatchBackfillRequest_WHEN_callingStopMatchBackfill_THEN_returnSuccessOutcome) {
     // GIVEN
     MessageCaptor stopMatchBackfill;
@@ -922,6 +1102,123 @@ TEST_F(GameLiftServerStateTest, GIVEN_retriable_failure_WHEN_sendMessage_THEN_re
     // THEN
     ASSERT_TRUE(outcome.IsSuccess());
 }
+
+namespace {
+// Like WebSocketppClientWrapper, keeps asynchronous heartbeats waiting for a response until the
+// connection is closed. With holdRequests unset it answers everything right away.
+class HoldingWebSocketClientWrapper : public IWebSocketClientWrapper {
+public:
+    HoldingWebSocketClientWrapper() : holdRequests(false), connected(false) {}
+
+    GenericOutcome Connect(const Uri &) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        connected = true;
+        return GenericOutcome(nullptr);
+    }
+
+    GenericOutcome SendSocketMessage(const std::string &, const std::string &) override { return GenericOutcome(nullptr); }
+
+    void SendSocketMessageAsync(const std::string &, const char *message, size_t length,
+                                const std::function<void(const GenericOutcome &)> &onResponse) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (holdRequests && std::string(message, length).find("HeartbeatServerProcess") != std::string::npos) {
+                heldRequests.push_back(onResponse);
+                return;
+            }
+        }
+        onResponse(holdRequests ? GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)) : GenericOutcome(nullptr));
+    }
+
+    void Disconnect() override {
+        std::vector<std::function<void(const GenericOutcome &)>> closedRequests;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            connected = false;
+            closedRequests.swap(heldRequests);
+        }
+        for (const auto &onResponse : closedRequests) {
+            onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+        }
+    }
+
+    void RegisterGameLiftCallback(const std::string &, const std::function<GenericOutcome(const rapidjson::Value &)> &) override {}
+
+    bool IsConnected() override {
+        std::lock_guard<std::mutex> lock(mutex);
+        return connected;
+    }
+
+    std::atomic<bool> holdRequests;
+
+private:
+    std::mutex mutex;
+    bool connected;
+    std::vector<std::function<void(const GenericOutcome &)>> heldRequests;
+};
+} // namespace
+
+class GameLiftServerStateReconnectTest : public ::testing::Test {
+protected:
+    GameLiftServerState *serverState = nullptr;
+    std::weak_ptr<HoldingWebSocketClientWrapper> initialWebSocketClientWrapper;
+
+    void SetUp() override {
+#ifdef GAMELIFT_USE_STD
+        std::shared_ptr<HoldingWebSocketClientWrapper> webSocketClientWrapper = std::make_shared<HoldingWebSocketClientWrapper>();
+        Server::InitSDKOutcome initOutcome = GameLiftServerState::CreateInstance(webSocketClientWrapper);
+#else
+        Internal::InitSDKOutcome initOutcome = GameLiftServerState::CreateInstance<HoldingWebSocketClientWrapper>();
+        std::shared_ptr<HoldingWebSocketClientWrapper> webSocketClientWrapper;
+        if (initOutcome.IsSuccess()) {
+            webSocketClientWrapper = std::dynamic_pointer_cast<HoldingWebSocketClientWrapper>(initOutcome.GetResult()->GetWebSocketClientWrapper());
+        }
+#endif
+        ASSERT_TRUE(initOutcome.IsSuccess());
+        serverState = initOutcome.GetResult();
+        webSocketClientWrapper->holdRequests = true;
+        initialWebSocketClientWrapper = webSocketClientWrapper;
+        serverState->SetWebSocketClientWrapperFactory([] { return std::make_shared<HoldingWebSocketClientWrapper>(); });
+
+        Aws::GameLift::Server::Model::ServerParameters serverParameters("wss://test.amazonaws.com/alpha", "AuthToken", "fleet-123", "i-123", "process-123");
+        ASSERT_TRUE(serverState->InitializeNetworking(serverParameters).IsSuccess());
+    }
+
+    void TearDown() override {
+        if (serverState) {
+            serverState->DestroyInstance();
+            serverState = nullptr;
+        }
+    }
+};
+
+TEST_F(GameLiftServerStateReconnectTest, GIVEN_asyncRequestWaitingForResponse_WHEN_reconnecting_THEN_requestCompletesOnNewConnection) {
+    // GIVEN
+    std::promise<GenericOutcome> heldOutcome;
+    serverState->SendSocketMessageWithRetriesAsync(std::make_shared<HeartbeatServerProcessRequest>(HeartbeatServerProcessRequest().WithHealthy(true)),
+                                                   [&heldOutcome](const GenericOutcome &outcome) { heldOutcome.set_value(outcome); });
+
+    // WHEN - this request keeps failing until the SDK reconnects
+    std::promise<GenericOutcome> reconnectingOutcome;
+    serverState->SendSocketMessageWithRetriesAsync(
+        std::make_shared<RemovePlayerSessionRequest>(RemovePlayerSessionRequest().WithGameSessionId("gameSessionId").WithPlayerSessionId("playerSessionId")),
+        [&reconnectingOutcome](const GenericOutcome &outcome) { reconnectingOutcome.set_value(outcome); });
+
+    // THEN - both complete well before the 20 second response timeout
+    std::future<GenericOutcome> heldFuture = heldOutcome.get_future();
+    std::future<GenericOutcome> reconnectingFuture = reconnectingOutcome.get_future();
+    ASSERT_EQ(std::future_status::ready, reconnectingFuture.wait_for(std::chrono::seconds(10)));
+    ASSERT_EQ(std::future_status::ready, heldFuture.wait_for(std::chrono::seconds(10)));
+    EXPECT_TRUE(reconnectingFuture.get().IsSuccess());
+    EXPECT_TRUE(heldFuture.get().IsSuccess());
+
+    // The replaced connection is released, not leaked. The reconnect thread may still be letting go of it.
+    for (int i = 0; i < 100 && !initialWebSocketClientWrapper.expired(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_TRUE(initialWebSocketClientWrapper.expired());
+}
+
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
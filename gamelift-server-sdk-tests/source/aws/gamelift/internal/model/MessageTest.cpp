@@ -106,6 +106,21 @@ TEST_F(MessageTest, GIVEN_validInput_WHEN_serialize_THEN_success) {
     ASSERT_EQ(serializedMessage, serializedTestMessage);
 }
 
+TEST_F(MessageTest, GIVEN_reusedBuffer_WHEN_serializeIntoBuffer_THEN_bufferHoldsOnlyLatestMessage) {
+    // GIVEN
+    rapidjson::StringBuffer buffer;
+    Message otherMessage;
+    otherMessage.SetAction("aMuchLongerActionNameThanTheTestAction");
+    otherMessage.SetRequestId(testRequestId);
+    ASSERT_TRUE(otherMessage.Serialize(buffer));
+    // WHEN
+    const Message *message = &testMessage;
+    bool success = message->Serialize(buffer);
+    // THEN
+    ASSERT_TRUE(success);
+    ASSERT_EQ(std::string(buffer.GetString(), buffer.GetSize()), serializedTestMessage);
+}
+
 TEST_F(MessageTest, GIVEN_validInput_WHEN_deserialize_THEN_success) {
     // GIVEN
     Message message;
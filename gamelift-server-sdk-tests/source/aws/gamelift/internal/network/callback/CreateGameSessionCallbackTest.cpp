@@ -84,6 +84,27 @@ TEST_F(CreateGameSessionCallbackTest, GIVEN_createMessage_WHEN_onStartGameSessio
 #endif
 }
 
+TEST_F(CreateGameSessionCallbackTest, GIVEN_insituParsedDocument_WHEN_onStartGameSession_THEN_success) {
+    // GIVEN / EXPECT
+    std::string jsonMessage = "{\"GameSessionId\":\"gameSessionId\",\"GameSessionName\":\"gameName\"}";
+    rapidjson::Document document;
+    document.ParseInsitu(&jsonMessage[0]);
+    EXPECT_CALL(*mockGameLiftMessageHandler, OnStartGameSession(testing::_))
+        .WillOnce(testing::Invoke(this, &CreateGameSessionCallbackTest::captureGameSessionMessage));
+
+    // WHEN
+    createGameSessionCallback->OnStartGameSession(document);
+
+    // THEN
+#ifdef GAMELIFT_USE_STD
+    EXPECT_EQ(capturedGameSession.GetGameSessionId(), "gameSessionId");
+    EXPECT_EQ(capturedGameSession.GetName(), "gameName");
+#else
+    EXPECT_STREQ(capturedGameSession.GetGameSessionId(), "gameSessionId");
+    EXPECT_STREQ(capturedGameSession.GetName(), "gameName");
+#endif
+}
+
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
@@ -62,6 +62,22 @@ TEST_F(DescribePlayerSessionsCallbackTest, GIVEN_createMessage_WHEN_onDescribePl
     delete response;
 }
 
+TEST_F(DescribePlayerSessionsCallbackTest, GIVEN_parsedDocument_WHEN_onDescribePlayerSessions_THEN_success) {
+    // GIVEN / EXPECT
+    rapidjson::Document document;
+    document.Parse("{\"NextToken\":\"nextToken\",\"PlayerSessions\":[{},{}]}");
+
+    // WHEN
+    GenericOutcome genericOutcome = describePlayerSessionCallback->OnDescribePlayerSessions(document);
+    WebSocketDescribePlayerSessionsResponse *response = static_cast<WebSocketDescribePlayerSessionsResponse *>(genericOutcome.GetResult());
+
+    // THEN
+    EXPECT_EQ(response->GetNextToken(), "nextToken");
+    EXPECT_EQ(response->GetPlayerSessions().size(), 2);
+
+    delete response;
+}
+
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
@@ -0,0 +1,74 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/retry/AsyncRetryingCallable.h>
+#include <aws/gamelift/internal/retry/MockRetryStrategy.h>
+#include <chrono>
+#include <future>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+TEST(AsyncRetryingCallableTest, GIVEN_eventuallySucceedingCallable_WHEN_call_THEN_retriesOnTimerUntilSuccess) {
+    // GIVEN
+    MockRetryStrategy strategy;
+    EXPECT_CALL(strategy, GetRetryDelayMillis(testing::_)).WillRepeatedly(testing::Return(10));
+    TaskScheduler scheduler;
+    int attempts = 0;
+    std::promise<bool> completed;
+    std::future<bool> completedFuture = completed.get_future();
+    AsyncRetryingCallable callable = AsyncRetryingCallable::Builder()
+                                         .WithRetryStrategy(&strategy)
+                                         .WithTaskScheduler(&scheduler)
+                                         .WithCallable([&attempts](const AsyncRetryingCallable::AttemptCallback &done) { done(++attempts > 2); })
+                                         .WithOnComplete([&completed](bool succeeded) { completed.set_value(succeeded); })
+                                         .Build();
+    // WHEN
+    callable.call();
+    // THEN
+    ASSERT_EQ(std::future_status::ready, completedFuture.wait_for(std::chrono::seconds(5)));
+    ASSERT_TRUE(completedFuture.get());
+    ASSERT_EQ(3, attempts);
+}
+
+TEST(AsyncRetryingCallableTest, GIVEN_retriesExhausted_WHEN_call_THEN_completeWithFailure) {
+    // GIVEN
+    MockRetryStrategy strategy;
+    EXPECT_CALL(strategy, GetRetryDelayMillis(1)).WillOnce(testing::Return(-1));
+    TaskScheduler scheduler;
+    int attempts = 0;
+    std::promise<bool> completed;
+    std::future<bool> completedFuture = completed.get_future();
+    AsyncRetryingCallable callable = AsyncRetryingCallable::Builder()
+                                         .WithRetryStrategy(&strategy)
+                                         .WithTaskScheduler(&scheduler)
+                                         .WithCallable([&attempts](const AsyncRetryingCallable::AttemptCallback &done) {
+                                             attempts++;
+                                             done(false);
+                                         })
+                                         .WithOnComplete([&completed](bool succeeded) { completed.set_value(succeeded); })
+                                         .Build();
+    // WHEN
+    callable.call();
+    // THEN
+    ASSERT_EQ(std::future_status::ready, completedFuture.wait_for(std::chrono::seconds(5)));
+    ASSERT_FALSE(completedFuture.get());
+    ASSERT_EQ(1, attempts);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -49,6 +49,16 @@ TEST(GeometricBackoffRetryStrategyTest, GIVEN_DefaultSettings_WHEN_callWithAlway
     ASSERT_EQ(calls, 1);
 }
 
+TEST(GeometricBackoffRetryStrategyTest, GIVEN_DefaultSettings_WHEN_getRetryDelayMillis_THEN_growsGeometricallyUpToMaxRetries) {
+    // GIVEN
+    GeometricBackoffRetryStrategy geometricBackoffRetryStrategy;
+    // WHEN / THEN
+    ASSERT_EQ(4000, geometricBackoffRetryStrategy.GetRetryDelayMillis(1));
+    ASSERT_EQ(8000, geometricBackoffRetryStrategy.GetRetryDelayMillis(2));
+    ASSERT_EQ(32000, geometricBackoffRetryStrategy.GetRetryDelayMillis(6));
+    ASSERT_LT(geometricBackoffRetryStrategy.GetRetryDelayMillis(7), 0);
+}
+
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
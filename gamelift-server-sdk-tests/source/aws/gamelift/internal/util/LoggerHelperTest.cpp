@@ -0,0 +1,120 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/util/LoggerHelper.h>
+#include <chrono>
+#include <future>
+#include <spdlog/spdlog.h>
+#include <string>
+
+using namespace Aws::GameLift::Server::Model;
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+namespace {
+struct CapturedLog {
+    std::promise<std::string> message;
+    LogLevel level;
+};
+
+void CaptureLog(CapturedLog *capturedLog, LogLevel level, const char *message, size_t length) {
+    std::string text(message, length);
+    if (text == "LoggerHelperTest message") {
+        capturedLog->level = level;
+        capturedLog->message.set_value(text);
+    }
+}
+
+#ifndef GAMELIFT_USE_STD
+void CaptureLogWithState(LogLevel level, const char *message, size_t length, void *state) { CaptureLog(static_cast<CapturedLog *>(state), level, message, length); }
+#endif
+
+LoggerParameters WithCaptureSink(LoggerParameters loggerParameters, CapturedLog *capturedLog) {
+#ifdef GAMELIFT_USE_STD
+    return loggerParameters.WithLogSink([capturedLog](LogLevel level, const char *message, size_t length) { CaptureLog(capturedLog, level, message, length); });
+#else
+    return loggerParameters.WithLogSink(&CaptureLogWithState, capturedLog);
+#endif
+}
+} // namespace
+
+class LoggerHelperTest : public ::testing::Test {
+protected:
+    void TearDown() override { LoggerHelper::InitializeLogger("testProcessId"); }
+};
+
+TEST_F(LoggerHelperTest, GIVEN_logSink_WHEN_logging_THEN_sinkReceivesMessageOnCallingThread) {
+    // GIVEN
+    CapturedLog capturedLog;
+    std::future<std::string> message = capturedLog.message.get_future();
+    LoggerHelper::InitializeLogger("testProcessId", WithCaptureSink(LoggerParameters(), &capturedLog));
+
+    // WHEN
+    spdlog::warn("LoggerHelperTest message");
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, message.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ("LoggerHelperTest message", message.get());
+    EXPECT_EQ(LogLevel::Warn, capturedLog.level);
+}
+
+TEST_F(LoggerHelperTest, GIVEN_asyncLogging_WHEN_logging_THEN_sinkReceivesMessage) {
+    // GIVEN
+    CapturedLog capturedLog;
+    std::future<std::string> message = capturedLog.message.get_future();
+    LoggerHelper::InitializeLogger("testProcessId", WithCaptureSink(LoggerParameters().WithAsyncLogging(true), &capturedLog));
+
+    // WHEN
+    spdlog::info("LoggerHelperTest message");
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, message.wait_for(std::chrono::seconds(5)));
+    EXPECT_EQ("LoggerHelperTest message", message.get());
+    EXPECT_EQ(LogLevel::Info, capturedLog.level);
+}
+
+TEST_F(LoggerHelperTest, GIVEN_asyncLogging_WHEN_flushingLogger_THEN_queuedMessageIsWrittenBeforeReturning) {
+    // GIVEN
+    CapturedLog capturedLog;
+    std::future<std::string> message = capturedLog.message.get_future();
+    LoggerHelper::InitializeLogger("testProcessId", WithCaptureSink(LoggerParameters().WithAsyncLogging(true), &capturedLog));
+    spdlog::info("LoggerHelperTest message");
+
+    // WHEN
+    LoggerHelper::FlushLogger();
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, message.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ("LoggerHelperTest message", message.get());
+}
+
+TEST_F(LoggerHelperTest, GIVEN_logLevelAboveMessage_WHEN_logging_THEN_messageIsDiscarded) {
+    // GIVEN
+    CapturedLog capturedLog;
+    std::future<std::string> message = capturedLog.message.get_future();
+    LoggerHelper::InitializeLogger("testProcessId", WithCaptureSink(LoggerParameters().WithLogLevel(LogLevel::Error), &capturedLog));
+
+    // WHEN
+    spdlog::warn("LoggerHelperTest message");
+
+    // THEN
+    ASSERT_EQ(std::future_status::timeout, message.wait_for(std::chrono::seconds(0)));
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
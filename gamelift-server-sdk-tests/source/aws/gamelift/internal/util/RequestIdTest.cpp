@@ -0,0 +1,69 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/util/RequestId.h>
+
+using namespace testing;
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+TEST(RequestIdTest, GIVEN_generatedRequestId_WHEN_toString_THEN_returns32AlphaNumericCharacters) {
+    // GIVEN
+    RequestId requestId = RequestId::Generate();
+    // WHEN
+    std::string text = requestId.ToString();
+    // THEN
+    ASSERT_THAT(text, MatchesRegex("[a-zA-Z0-9]{32}"));
+}
+
+TEST(RequestIdTest, GIVEN_multipleGeneratedRequestIds_WHEN_compare_THEN_areDifferent) {
+    // GIVEN
+    RequestId requestId1 = RequestId::Generate();
+    RequestId requestId2 = RequestId::Generate();
+    // WHEN / THEN
+    ASSERT_NE(requestId1, requestId2);
+    ASSERT_NE(requestId1.ToString(), requestId2.ToString());
+}
+
+TEST(RequestIdTest, GIVEN_requestIdText_WHEN_parse_THEN_roundTrips) {
+    // GIVEN
+    RequestId requestId(0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+    std::string text = requestId.ToString();
+    RequestId parsedRequestId;
+    // WHEN
+    bool parsed = RequestId::Parse(text, parsedRequestId);
+    // THEN
+    ASSERT_TRUE(parsed);
+    ASSERT_EQ("0123456789abcdeffedcba9876543210", text);
+    ASSERT_EQ(requestId, parsedRequestId);
+    ASSERT_EQ(RequestId::Hash()(requestId), RequestId::Hash()(parsedRequestId));
+}
+
+TEST(RequestIdTest, GIVEN_invalidText_WHEN_parse_THEN_fails) {
+    // GIVEN
+    RequestId parsedRequestId;
+    // WHEN / THEN
+    ASSERT_FALSE(RequestId::Parse("", parsedRequestId));
+    ASSERT_FALSE(RequestId::Parse("0123456789abcdef", parsedRequestId));
+    ASSERT_FALSE(RequestId::Parse("0123456789abcdefghijklmnopqrstuv", parsedRequestId));
+    ASSERT_EQ(RequestId(), parsedRequestId);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,67 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/util/TaskScheduler.h>
+#include <atomic>
+#include <future>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+TEST(TaskSchedulerTest, GIVEN_postedTask_WHEN_schedulerRunning_THEN_taskRuns) {
+    // GIVEN
+    TaskScheduler scheduler;
+    std::promise<void> ran;
+    std::future<void> ranFuture = ran.get_future();
+    // WHEN
+    scheduler.Post([&ran] { ran.set_value(); });
+    // THEN
+    ASSERT_EQ(std::future_status::ready, ranFuture.wait_for(std::chrono::seconds(5)));
+}
+
+TEST(TaskSchedulerTest, GIVEN_delayedAndImmediateTasks_WHEN_schedulerRunning_THEN_runInDueTimeOrder) {
+    // GIVEN
+    TaskScheduler scheduler;
+    std::string order;
+    std::promise<void> done;
+    std::future<void> doneFuture = done.get_future();
+    // WHEN
+    scheduler.PostAfter(100, [&order, &done] {
+        order += "b";
+        done.set_value();
+    });
+    scheduler.Post([&order] { order += "a"; });
+    // THEN
+    ASSERT_EQ(std::future_status::ready, doneFuture.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ("ab", order);
+}
+
+TEST(TaskSchedulerTest, GIVEN_pendingDelayedTask_WHEN_shutdown_THEN_taskDropped) {
+    // GIVEN
+    std::atomic<int> runs(0);
+    TaskScheduler scheduler;
+    scheduler.PostAfter(60 * 1000, [&runs] { runs++; });
+    // WHEN
+    scheduler.Shutdown();
+    scheduler.Post([&runs] { runs++; });
+    // THEN
+    ASSERT_EQ(0, runs.load());
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,88 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/util/ThreadPool.h>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+TEST(ThreadPoolTest, GIVEN_singleWorker_WHEN_tasksPosted_THEN_runInPostedOrder) {
+    // GIVEN
+    ThreadPool threadPool(1);
+    std::vector<int> order;
+    std::promise<void> done;
+    std::future<void> doneFuture = done.get_future();
+    // WHEN
+    for (int i = 0; i < 100; ++i) {
+        threadPool.Post([&order, i] { order.push_back(i); }, "Append");
+    }
+    threadPool.Post([&done] { done.set_value(); }, "Done");
+    // THEN
+    ASSERT_EQ(std::future_status::ready, doneFuture.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(100u, order.size());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+TEST(ThreadPoolTest, GIVEN_tasksThatThrow_WHEN_run_THEN_workerKeepsRunningTasks) {
+    // GIVEN
+    ThreadPool threadPool(1);
+    std::promise<void> done;
+    std::future<void> doneFuture = done.get_future();
+    // WHEN
+    threadPool.Post([] { throw std::runtime_error("callback failed"); }, "ThrowsStdException");
+    threadPool.Post([] { throw 42; }, "ThrowsInt");
+    threadPool.Post([&done] { done.set_value(); }, "Done");
+    // THEN
+    ASSERT_EQ(std::future_status::ready, doneFuture.wait_for(std::chrono::seconds(5)));
+}
+
+TEST(ThreadPoolTest, GIVEN_runningAndPendingTasks_WHEN_shutdown_THEN_runningTaskFinishesAndPendingTaskDropped) {
+    // GIVEN
+    ThreadPool threadPool(1);
+    std::atomic<int> pendingRuns(0);
+    std::promise<void> started;
+    std::future<void> startedFuture = started.get_future();
+    std::promise<void> release;
+    std::shared_future<void> releaseFuture = release.get_future().share();
+    std::promise<void> finished;
+    std::future<void> finishedFuture = finished.get_future();
+    threadPool.Post(
+        [&started, releaseFuture, &finished] {
+            started.set_value();
+            releaseFuture.wait();
+            finished.set_value();
+        },
+        "Blocking");
+    threadPool.Post([&pendingRuns] { pendingRuns++; }, "Pending");
+    ASSERT_EQ(std::future_status::ready, startedFuture.wait_for(std::chrono::seconds(5)));
+    // WHEN - returns without waiting for the blocked task
+    threadPool.Shutdown();
+    threadPool.Post([&pendingRuns] { pendingRuns++; }, "PostedAfterShutdown");
+    release.set_value();
+    // THEN
+    ASSERT_EQ(std::future_status::ready, finishedFuture.wait_for(std::chrono::seconds(5)));
+    ASSERT_EQ(0, pendingRuns.load());
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
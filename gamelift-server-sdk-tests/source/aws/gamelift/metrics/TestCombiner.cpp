@@ -296,3 +296,17 @@ TEST(CombinerTimerTests,
   EXPECT_THAT(Results[&MetricTimer2::Instance()].SubmitDouble.Value,
               DoubleEq(54.4));
 }
+
+TEST(CombinerTimerTests, WhenClearedBetweenSamples_ThenMeanStartsOver) {
+  Combiner MetricsCombiner;
+
+  MetricsCombiner.Add(MetricMessage::TimerSet(MetricTimer::Instance(), 10));
+  MetricsCombiner.Add(MetricMessage::TimerSet(MetricTimer::Instance(), 20));
+  MetricsCombiner.Clear();
+
+  MetricsCombiner.Add(MetricMessage::TimerSet(MetricTimer::Instance(), 40));
+  MetricsCombiner.Add(MetricMessage::TimerSet(MetricTimer::Instance(), 60));
+
+  EXPECT_THAT(MetricsCombiner, UnorderedElementsAre(MetricMessage::TimerSet(
+                                   MetricTimer::Instance(), 50)));
+}
@@ -0,0 +1,167 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "Common.h"
+#include "MetricMacrosTests.h"
+#include "MockDerivedMetric.h"
+
+#include <aws/gamelift/metrics/MetricsProcessor.h>
+#include <string>
+#include <vector>
+
+#include <aws/gamelift/metrics/DefinitionMacros.h>
+#include <aws/gamelift/metrics/Histogram.h>
+#include <aws/gamelift/metrics/Samplers.h>
+#include <aws/gamelift/metrics/Tags.h>
+
+using namespace ::testing;
+
+struct HistogramTests : public PacketSendTest {};
+
+namespace {
+GAMELIFT_METRICS_DECLARE_GAUGE(MetricGauge, "gauge", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll());
+GAMELIFT_METRICS_DEFINE_GAUGE(MetricGauge);
+
+GAMELIFT_METRICS_DECLARE_TIMER(MetricTimer, "timer", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll());
+GAMELIFT_METRICS_DEFINE_TIMER(MetricTimer);
+
+GAMELIFT_METRICS_DECLARE_TIMER(TickTime, "tick_time", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll(),
+                               Aws::GameLift::Metrics::Histogram(10, 20, 50));
+GAMELIFT_METRICS_DEFINE_TIMER(TickTime);
+
+GAMELIFT_METRICS_DECLARE_GAUGE(Balance, "balance", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll(),
+                               Aws::GameLift::Metrics::Histogram(1000000,
+                                                                 1000001));
+GAMELIFT_METRICS_DEFINE_GAUGE(Balance);
+
+// Frees the tags allocated by tag messages that were never processed.
+void FreeTags(std::vector<MetricMessage> &Messages) {
+  Tags TagHandler;
+  for (auto &Message : Messages) {
+    if (Message.IsTag()) {
+      TagHandler.Handle(Message);
+    }
+  }
+}
+} // namespace
+
+TEST_F(HistogramTests,
+       WhenTimerSetMessagesHandled_ThenEmitsCumulativeBucketCounters) {
+  auto Histogram = Aws::GameLift::Metrics::Histogram(50, 10, 20);
+
+  MockVectorEnqueuer Results;
+  for (double Value : {5, 10, 12, 35, 35, 80}) {
+    auto SetMessage = MetricMessage::TimerSet(MetricTimer::Instance(), Value);
+    Histogram.HandleMessage(SetMessage, Results);
+  }
+  Histogram.EmitMetrics(&MetricTimer::Instance(), Results);
+
+  // One le tag per bucket, then the bucket counters and the sum gauge.
+  ASSERT_THAT(Results.Values, SizeIs(9));
+
+  const char *Bounds[] = {"10", "20", "50", "+Inf"};
+  const double Counts[] = {2, 3, 5, 6};
+  for (int i = 0; i < 4; ++i) {
+    const MetricMessage &Tag = Results.Values[i];
+    ASSERT_EQ(Tag.Type, MetricMessageType::TagSet);
+    EXPECT_THAT(Tag.Metric->GetKey(), StrEq("timer.bucket"));
+    EXPECT_EQ(Tag.SetTag.Ptr->Key, "le");
+    EXPECT_EQ(Tag.SetTag.Ptr->Value, Bounds[i]);
+
+    const MetricMessage &Bucket = Results.Values[4 + i];
+    EXPECT_EQ(Bucket.Metric, Tag.Metric);
+    EXPECT_EQ(Bucket.Type, MetricMessageType::CounterAdd);
+    EXPECT_EQ(Bucket.SubmitDouble.Value, Counts[i]);
+  }
+
+  const MetricMessage &Sum = Results.Values[8];
+  EXPECT_THAT(Sum.Metric->GetKey(), StrEq("timer.sum"));
+  EXPECT_EQ(Sum.Type, MetricMessageType::GaugeSet);
+  EXPECT_EQ(Sum.SubmitDouble.Value, 177);
+
+  FreeTags(Results.Values);
+}
+
+TEST_F(HistogramTests, WhenEmittedTwice_ThenOnlyCountsNewValues) {
+  auto Histogram = Aws::GameLift::Metrics::ExponentialHistogram(1, 2, 4);
+
+  MockVectorEnqueuer Results;
+  for (double Value : {1, 3}) {
+    auto SetMessage = MetricMessage::GaugeSet(MetricGauge::Instance(), Value);
+    Histogram.HandleMessage(SetMessage, Results);
+  }
+  Histogram.EmitMetrics(&MetricGauge::Instance(), Results);
+  FreeTags(Results.Values);
+  Results.Values.clear();
+
+  // Gauge adds are counted at the resulting gauge value.
+  auto AddMessage = MetricMessage::GaugeAdd(MetricGauge::Instance(), 5);
+  Histogram.HandleMessage(AddMessage, Results);
+  Histogram.EmitMetrics(&MetricGauge::Instance(), Results);
+
+  // Bounds 1, 2, 4, 8: only the 8 and +Inf buckets hold the new value.
+  ASSERT_THAT(Results.Values, SizeIs(3));
+  EXPECT_EQ(Results.Values[0], MetricMessage::CounterAdd(
+                                   *Results.Values[0].Metric, 1));
+  EXPECT_EQ(Results.Values[1], MetricMessage::CounterAdd(
+                                   *Results.Values[1].Metric, 1));
+  EXPECT_NE(Results.Values[0].Metric, Results.Values[1].Metric);
+  EXPECT_THAT(Results.Values[2].Metric->GetKey(), StrEq("gauge.sum"));
+  EXPECT_EQ(Results.Values[2].SubmitDouble.Value, 8);
+
+  // Nothing recorded, nothing emitted.
+  Results.Values.clear();
+  Histogram.EmitMetrics(&MetricGauge::Instance(), Results);
+  EXPECT_THAT(Results.Values, IsEmpty());
+}
+
+TEST_F(HistogramTests, WhenProcessed_ThenSendsTaggedBucketCounters) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor Processor(Settings);
+
+  Processor.Enqueue(MetricMessage::TimerSet(TickTime::Instance(), 8));
+  Processor.Enqueue(MetricMessage::TimerSet(TickTime::Instance(), 16));
+  Processor.Enqueue(MetricMessage::TimerSet(TickTime::Instance(), 33));
+  Processor.ProcessMetricsNow();
+
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  const std::string PacketContents = std::get<0>(OutputPackets[0]);
+  EXPECT_THAT(PacketContents, HasSubstr("tick_time:19|ms\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("tick_time.bucket:1|c|#le:10\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("tick_time.bucket:2|c|#le:20\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("tick_time.bucket:3|c|#le:50\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("tick_time.bucket:3|c|#le:+Inf\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("tick_time.sum:57|g\n"));
+}
+
+TEST_F(HistogramTests, WhenBoundsClose_ThenTagsAreDistinctAndSumIsSent) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor Processor(Settings);
+
+  Processor.Enqueue(MetricMessage::GaugeSet(Balance::Instance(), -5));
+  Processor.ProcessMetricsNow();
+
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  const std::string PacketContents = std::get<0>(OutputPackets[0]);
+  EXPECT_THAT(PacketContents, HasSubstr("balance.bucket:1|c|#le:1000000\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("balance.bucket:1|c|#le:1000001\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("balance.sum:-5|g\n"));
+}
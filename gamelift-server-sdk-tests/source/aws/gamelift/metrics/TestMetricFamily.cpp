@@ -0,0 +1,134 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "Common.h"
+#include "MetricMacrosTests.h"
+
+#include <aws/gamelift/metrics/DefinitionMacros.h>
+#include <aws/gamelift/metrics/MetricFamily.h>
+#include <aws/gamelift/metrics/MetricsProcessor.h>
+#include <aws/gamelift/metrics/Samplers.h>
+
+#include <new>
+#include <string>
+#include <type_traits>
+
+using namespace ::testing;
+
+namespace {
+GAMELIFT_METRICS_DECLARE_GAUGE(MetricPlayers, "players", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll());
+GAMELIFT_METRICS_DEFINE_GAUGE(MetricPlayers);
+} // namespace
+
+struct MetricFamilyTests : public MetricMacrosTests {};
+
+struct MetricFamilyProcessorTests : public PacketSendTest {};
+
+TEST_F(MetricFamilyTests, WhenSameLabels_ThenReturnsSameChild) {
+  Aws::GameLift::Metrics::MetricFamily<MetricPlayers> Family;
+
+  auto &Dust = Family.WithLabels("map", "dust").GetMetric();
+  auto &DustRanked =
+      Family.WithLabels("map", "dust", "mode", "ranked").GetMetric();
+  auto &Nuke = Family.WithLabels("map", "nuke").GetMetric();
+
+  EXPECT_EQ(&Family.WithLabels("map", "dust").GetMetric(), &Dust);
+  EXPECT_EQ(&Family.WithLabels("mode", "ranked", "map", "dust").GetMetric(),
+            &DustRanked);
+#ifdef GAMELIFT_USE_STD
+  const std::string MapName = "nuke";
+  EXPECT_EQ(&Family.WithLabels("map", MapName).GetMetric(), &Nuke);
+#endif
+  EXPECT_NE(&Dust, &Nuke);
+  EXPECT_NE(&Dust, &DustRanked);
+  EXPECT_EQ(Family.GetChildCount(), 3u);
+
+  EXPECT_STREQ(Dust.GetKey(), "players");
+  EXPECT_EQ(Dust.GetMetricType(), Aws::GameLift::Metrics::MetricType::Gauge);
+  EXPECT_FALSE(Dust.HasDerivedMetrics());
+  ASSERT_EQ(DustRanked.GetLabelCount(), 2);
+  EXPECT_STREQ(DustRanked.GetLabelKey(0), "map");
+  EXPECT_STREQ(DustRanked.GetLabelValue(0), "dust");
+  EXPECT_STREQ(DustRanked.GetLabelKey(1), "mode");
+  EXPECT_STREQ(DustRanked.GetLabelValue(1), "ranked");
+}
+
+TEST_F(MetricFamilyTests, WhenChildSubmittedTwice_ThenLabelsAreEnqueuedOnce) {
+  Aws::GameLift::Metrics::MetricFamily<MetricPlayers> Family;
+  auto &Dust = Family.WithLabels("map", "dust", "mode", "ranked").GetMetric();
+
+  {
+    InSequence Sequence;
+    EXPECT_CALL(MockProcessor, Enqueue(Field(&MetricMessage::Type,
+                                             MetricMessageType::TagSet)))
+        .Times(2);
+    EXPECT_CALL(MockProcessor, Enqueue(Field(&MetricMessage::Type,
+                                             MetricMessageType::GaugeSet)))
+        .Times(2);
+  }
+
+  Dust.Submit(MockProcessor, MetricMessage::GaugeSet(Dust, 5));
+  Dust.Submit(MockProcessor, MetricMessage::GaugeSet(Dust, 6));
+}
+
+TEST_F(MetricFamilyProcessorTests, WhenChildrenProcessed_ThenLabelsAreTags) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor Processor(Settings);
+
+  Aws::GameLift::Metrics::MetricFamily<MetricPlayers> Family;
+  auto &Dust = Family.WithLabels("map", "dust").GetMetric();
+  auto &Nuke = Family.WithLabels("map", "nuke").GetMetric();
+
+  Dust.Submit(Processor, MetricMessage::GaugeSet(Dust, 5));
+  Nuke.Submit(Processor, MetricMessage::GaugeSet(Nuke, 7));
+  Processor.ProcessMetricsNow();
+
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  EXPECT_THAT(std::get<0>(OutputPackets[0]),
+              AllOf(HasSubstr("players:5|g|#map:dust\n"),
+                    HasSubstr("players:7|g|#map:nuke\n")));
+
+  // The processor keeps the labels after the first capture.
+  ClearOutputPackets();
+  Dust.Submit(Processor, MetricMessage::GaugeSet(Dust, 8));
+  Processor.ProcessMetricsNow();
+
+  EXPECT_THAT(OutputPackets,
+              ElementsAre(MakeResult("players:8|g|#map:dust\n", 23)));
+}
+
+TEST_F(MetricFamilyProcessorTests,
+       WhenProcessorReplacedAtSameAddress_ThenLabelsAreEnqueuedAgain) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.CaptureIntervalSec = 0;
+
+  Aws::GameLift::Metrics::MetricFamily<MetricPlayers> Family;
+  auto &Dust = Family.WithLabels("map", "dust").GetMetric();
+
+  // As after MetricsTerminate and MetricsInitialize, when the new processor
+  // is allocated where the old one was.
+  std::aligned_storage<sizeof(MetricsProcessor),
+                       alignof(MetricsProcessor)>::type Storage;
+  for (int i = 0; i < 2; ++i) {
+    MetricsProcessor *Processor = new (&Storage) MetricsProcessor(Settings);
+    Dust.Submit(*Processor, MetricMessage::GaugeSet(Dust, 5));
+    Processor->ProcessMetricsNow();
+    Processor->~MetricsProcessor();
+  }
+
+  EXPECT_THAT(OutputPackets,
+              ElementsAre(MakeResult("players:5|g|#map:dust\n", 23),
+                          MakeResult("players:5|g|#map:dust\n", 23)));
+}
@@ -13,6 +13,10 @@
 #include "MetricMacrosTests.h"
 
 #include <aws/gamelift/metrics/MetricsProcessor.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
 #include <thread>
 #include <vector>
 
@@ -523,6 +527,263 @@ TEST_F(MetricsProcessorTests, TestDerivativeMetrics) {
               HasSubstr("timer_with_derivs.p95:1874.70000|ms|#baz:boz\n"));
 }
 
+TEST_F(MetricsProcessorTests, WhenTagsChangeBetweenFlushes_ThenNextFlushUsesNewTags) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor Processor(Settings);
+
+  Processor.SetGlobalTag("foo", "bar");
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 1));
+  Processor.ProcessMetricsNow();
+
+  Processor.SetGlobalTag("foo", "baz");
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 2));
+  Processor.ProcessMetricsNow();
+
+  Processor.Enqueue(MetricMessage::TagSet(Foo::Instance(), "hello", "world"));
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 3));
+  Processor.ProcessMetricsNow();
+
+  Processor.RemoveGlobalTag("foo");
+  Processor.Enqueue(MetricMessage::TagRemove(Foo::Instance(), "hello"));
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 4));
+  Processor.ProcessMetricsNow();
+
+  ASSERT_THAT(OutputPackets, SizeIs(4));
+  EXPECT_EQ(std::get<0>(OutputPackets[0]), "foo:1|g|#foo:bar\n");
+  EXPECT_EQ(std::get<0>(OutputPackets[1]), "foo:2|g|#foo:baz\n");
+  EXPECT_EQ(std::get<0>(OutputPackets[2]), "foo:3|g|#foo:baz,hello:world\n");
+  EXPECT_EQ(std::get<0>(OutputPackets[3]), "foo:4|g\n");
+}
+
+TEST_F(MetricsProcessorTests, WhenGlobalTagAddedWithEmptyValue_ThenNextFlushUsesIt) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor Processor(Settings);
+
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 1));
+  Processor.ProcessMetricsNow();
+
+  Processor.SetGlobalTag("k", "");
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 2));
+  Processor.ProcessMetricsNow();
+
+  ASSERT_THAT(OutputPackets, SizeIs(2));
+  EXPECT_EQ(std::get<0>(OutputPackets[0]), "foo:1|g\n");
+  EXPECT_EQ(std::get<0>(OutputPackets[1]), "foo:2|g|#k:\n");
+}
+
+TEST_F(MetricsProcessorTests, WhenQueueIsFull_ThenDropsAndCountsMessages) {
+  constexpr int MessageCount = 1000;
+
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.MaxQueuedMessages = 64;
+  MetricsProcessor Processor(Settings);
+
+  for (int i = 0; i < MessageCount; ++i) {
+    Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 1));
+  }
+  Processor.Enqueue(MetricMessage::TagSet(FooCount::Instance(), "hello", "world"));
+  Processor.ProcessMetricsNow();
+
+  const uint64_t Dropped = Processor.GetDroppedMessageCount();
+  EXPECT_GT(Dropped, 0u);
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  EXPECT_EQ(std::get<0>(OutputPackets[0]),
+            "foo_count:" + std::to_string(MessageCount - Dropped) +
+                "|c|#hello:world\n");
+
+  // Processing drains the queue, so new messages fit again.
+  Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 1));
+  Processor.ProcessMetricsNow();
+  EXPECT_EQ(Processor.GetDroppedMessageCount(), Dropped);
+  ASSERT_THAT(OutputPackets, SizeIs(2));
+  EXPECT_EQ(std::get<0>(OutputPackets[1]), "foo_count:1|c|#hello:world\n");
+}
+
+TEST_F(MetricsProcessorTests,
+       WhenQueueFilledByManyThreads_ThenEveryThreadEnqueuesAfterDrain) {
+  constexpr int ThreadCount = 4;
+  constexpr int MessagesAfterDrain = 8;
+
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.MaxQueuedMessages = 64;
+  MetricsProcessor Processor(Settings);
+
+  std::atomic<int> FilledCount(0);
+  std::promise<void> Drained;
+  std::shared_future<void> DrainedFuture = Drained.get_future().share();
+  std::vector<std::thread> Producers;
+  for (int i = 0; i < ThreadCount; ++i) {
+    Producers.emplace_back([&]() {
+      for (int j = 0; j < 1000; ++j) {
+        Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 1));
+      }
+      ++FilledCount;
+
+      DrainedFuture.wait();
+      for (int j = 0; j < MessagesAfterDrain; ++j) {
+        Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 1));
+      }
+    });
+  }
+
+  while (FilledCount < ThreadCount) {
+    std::this_thread::yield();
+  }
+  Processor.ProcessMetricsNow();
+  const uint64_t Dropped = Processor.GetDroppedMessageCount();
+  EXPECT_EQ(Dropped, static_cast<uint64_t>(ThreadCount * 1000 - 64));
+
+  ClearOutputPackets();
+  Drained.set_value();
+  for (std::thread &Producer : Producers) {
+    Producer.join();
+  }
+  Processor.ProcessMetricsNow();
+
+  EXPECT_EQ(Processor.GetDroppedMessageCount(), Dropped);
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  EXPECT_EQ(std::get<0>(OutputPackets[0]),
+            "foo_count:" + std::to_string(ThreadCount * MessagesAfterDrain) +
+                "|c\n");
+}
+
+TEST_F(MetricsProcessorTests,
+       WhenThreadLocalAggregation_ThenCountersAndGaugesCombine) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.MaxQueuedMessages = 64;
+  Settings.ThreadLocalAggregation = true;
+  MetricsProcessor Processor(Settings);
+
+  // Far more updates than the queue holds, so none may be queued one by one.
+  std::thread Producer([&Processor]() {
+    for (int i = 0; i < 1000; ++i) {
+      Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 1));
+    }
+  });
+  for (int i = 0; i < 1000; ++i) {
+    Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 2));
+    Processor.Enqueue(MetricMessage::GaugeAdd(Bar::Instance(), 1));
+  }
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 5));
+  Processor.Enqueue(MetricMessage::GaugeAdd(Foo::Instance(), 2));
+  Processor.Enqueue(MetricMessage::TimerSet(FooTime::Instance(), 11));
+  Producer.join();
+
+  Processor.ProcessMetricsNow();
+
+  EXPECT_EQ(Processor.GetDroppedMessageCount(), 0u);
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  const std::string PacketContents = std::get<0>(OutputPackets[0]);
+  EXPECT_THAT(PacketContents, HasSubstr("foo_count:3000|c\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("bar:1000|g\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("foo:7|g\n"));
+  EXPECT_THAT(PacketContents, HasSubstr("foo_time:11|ms\n"));
+
+  // Aggregated values are handed over once per capture.
+  Processor.Enqueue(MetricMessage::CounterAdd(FooCount::Instance(), 1));
+  Processor.ProcessMetricsNow();
+  ASSERT_THAT(OutputPackets, SizeIs(2));
+  EXPECT_THAT(std::get<0>(OutputPackets[1]), HasSubstr("foo_count:1|c\n"));
+}
+
+TEST_F(MetricsProcessorTests, WhenProcessed_ThenCallsPostProcessingAfterSending) {
+  int PreProcessingCalls = 0;
+  size_t PacketsSentBeforePostProcessing = 0;
+
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.PreProcessingCallback = [&]() { ++PreProcessingCalls; };
+  Settings.PostProcessingCallback = [&]() {
+    PacketsSentBeforePostProcessing = OutputPackets.size();
+  };
+  MetricsProcessor Processor(Settings);
+
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 42));
+  Processor.ProcessMetricsNow();
+
+  EXPECT_EQ(PreProcessingCalls, 1);
+  EXPECT_EQ(PacketsSentBeforePostProcessing, 1u);
+}
+
+TEST_F(MetricsProcessorTests, WhenBackgroundFlush_ThenSendsFromFlushThread) {
+  std::promise<std::thread::id> FlushThreadId;
+  std::promise<std::string> SentPacket;
+  std::atomic<bool> Sent(false);
+
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = [&](const char *Packet, int) {
+    if (std::strstr(Packet, "foo:42|g") != nullptr && !Sent.exchange(true)) {
+      SentPacket.set_value(Packet);
+    }
+  };
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.BackgroundFlush = true;
+  Settings.FlushThreadStartCallback = [&]() {
+    FlushThreadId.set_value(std::this_thread::get_id());
+  };
+  MetricsProcessor Processor(Settings);
+  EXPECT_TRUE(Processor.IsBackgroundFlush());
+
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 42));
+
+  auto FlushThreadIdFuture = FlushThreadId.get_future();
+  auto SentPacketFuture = SentPacket.get_future();
+  ASSERT_EQ(SentPacketFuture.wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  EXPECT_THAT(SentPacketFuture.get(), HasSubstr("foo:42|g"));
+  EXPECT_NE(FlushThreadIdFuture.get(), std::this_thread::get_id());
+
+  Processor.StopBackgroundFlush();
+  EXPECT_FALSE(Processor.IsBackgroundFlush());
+}
+
+TEST_F(MetricsProcessorTests,
+       WhenBackgroundFlushCallbackSetsGlobalTag_ThenDoesNotDeadlock) {
+  std::promise<void> Tagged;
+  std::atomic<bool> TagSet(false);
+  // The flush thread starts in the constructor, before this is set.
+  std::atomic<MetricsProcessor *> ProcessorPtr(nullptr);
+
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = [&](const char *, int) {
+    MetricsProcessor *Processor = ProcessorPtr.load();
+    if (Processor != nullptr && !TagSet.exchange(true)) {
+      Processor->SetGlobalTag("from_callback", "1");
+      Tagged.set_value();
+    }
+  };
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.BackgroundFlush = true;
+  MetricsProcessor Processor(Settings);
+  ProcessorPtr = &Processor;
+
+  Processor.Enqueue(MetricMessage::GaugeSet(Foo::Instance(), 42));
+
+  auto TaggedFuture = Tagged.get_future();
+  EXPECT_EQ(TaggedFuture.wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  Processor.StopBackgroundFlush();
+}
+
 // Tests for OnStartGameSession
 TEST_F(MetricsProcessorTests, OnStartGameSession_WithValidSessionId_SetsGlobalTag)
 {
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include <aws/gamelift/metrics/DefinitionMacros.h>
+#include <aws/gamelift/metrics/DynamicMetric.h>
 #include <aws/gamelift/metrics/IMetricsProcessor.h>
 #include <aws/gamelift/metrics/Samplers.h>
 
@@ -79,6 +80,10 @@ struct MockMax : public Aws::GameLift::Metrics::IDerivedMetric {
 GAMELIFT_METRICS_DECLARE_GAUGE(MetricGaugeWithMax, "another_gauge", MockEnabled,
                                Aws::GameLift::Metrics::SampleAll(), MockMax());
 GAMELIFT_METRICS_DEFINE_GAUGE(MetricGaugeWithMax);
+
+GAMELIFT_METRICS_DECLARE_GAUGE(PlainGauge, "plain_gauge", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll());
+GAMELIFT_METRICS_DEFINE_GAUGE(PlainGauge);
 } // namespace
 
 TEST_F(
@@ -211,3 +216,43 @@ TEST_F(
   EXPECT_THAT(PacketContents, HasSubstr("another_gauge:52|g\n"));
   EXPECT_THAT(PacketContents, HasSubstr("another_gauge.max:1235|g\n"));
 }
+
+TEST_F(MetricsProcessorDerivedMetricTests,
+       GivenDeclaredMetrics_ThenHasDerivedMetricsMatchesDeclaration) {
+  static_assert(MetricGauge::DerivedMetricCount == 1,
+                "MetricGauge declares one derived metric.");
+  static_assert(PlainGauge::DerivedMetricCount == 0,
+                "PlainGauge declares no derived metrics.");
+
+  EXPECT_TRUE(MetricGauge::Instance().HasDerivedMetrics());
+  EXPECT_FALSE(PlainGauge::Instance().HasDerivedMetrics());
+  EXPECT_FALSE(Aws::GameLift::Metrics::DynamicMetric().HasDerivedMetrics());
+}
+
+TEST_F(MetricsProcessorDerivedMetricTests,
+       GivenGauge_WhenProcessedRepeatedly_ThenEmitMetricsCalledOncePerCapture) {
+  Aws::GameLift::Metrics::MetricsSettings Settings{};
+  Settings.MaxPacketSizeBytes = 4000;
+  Settings.CaptureIntervalSec = 0;
+  Settings.SendPacketCallback = MockSend;
+  MetricsProcessor Processor(Settings);
+
+  MockDerivedMetric *Metric = dynamic_cast<MockDerivedMetric *>(
+      GetNthDerivedMetric(&MetricGauge::Instance(), 0));
+  const int InitialCallsToEmit = Metric->CallsToEmit;
+
+  Processor.Enqueue(MetricMessage::GaugeSet(MetricGauge::Instance(), 1));
+  Processor.Enqueue(MetricMessage::GaugeSet(PlainGauge::Instance(), 1));
+  Processor.Enqueue(MetricMessage::GaugeSet(MetricGauge::Instance(), 2));
+  Processor.ProcessMetricsNow();
+  EXPECT_EQ(Metric->CallsToEmit, InitialCallsToEmit + 1);
+
+  // Only metrics logged during the capture period emit derived metrics.
+  Processor.Enqueue(MetricMessage::GaugeSet(PlainGauge::Instance(), 2));
+  Processor.ProcessMetricsNow();
+  EXPECT_EQ(Metric->CallsToEmit, InitialCallsToEmit + 1);
+
+  Processor.Enqueue(MetricMessage::GaugeSet(MetricGauge::Instance(), 3));
+  Processor.ProcessMetricsNow();
+  EXPECT_EQ(Metric->CallsToEmit, InitialCallsToEmit + 2);
+}
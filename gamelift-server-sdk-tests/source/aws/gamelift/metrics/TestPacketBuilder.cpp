@@ -290,6 +290,25 @@ TEST_F(
               ElementsAre(MakeResult("foo:1.43|g\nbar:1.43|ms\n", 24)));
 }
 
+TEST_F(PacketBuilderTests,
+       GivenPrecisionIs2_WhenLargeFloatsAppended_ThenEmitsFixedPointFloats) {
+  constexpr int PacketSize = 10000;
+  constexpr int Precision = 2;
+  PacketBuilder Builder(PacketSize, Precision);
+
+  Builder.Append(
+      MetricMessage::GaugeSet(MetricFooGauge::Instance(), 123456789012.345),
+      {}, {}, MockSend);
+  Builder.Append(
+      MetricMessage::GaugeAdd(MetricBarGauge::Instance(), -98765432.109), {},
+      {}, MockSend);
+  Builder.Flush(MockSend);
+
+  EXPECT_THAT(OutputPackets,
+              ElementsAre(MakeResult(
+                  "foo:123456789012.35|g\nbar:-98765432.11|g\n", 42)));
+}
+
 TEST_F(PacketBuilderTests,
        GivenSampleFractionMetric_WhenAppended_ThenEmitsSampleRateInPacket) {
   constexpr int PacketSize = 10000;
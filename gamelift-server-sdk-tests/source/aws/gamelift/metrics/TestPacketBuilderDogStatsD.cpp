@@ -14,7 +14,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
 #include <iomanip>
+#include <limits>
+#include <random>
 #include <sstream>
 #include <string>
 
@@ -49,6 +53,35 @@ GAMELIFT_METRICS_DEFINE_COUNTER(MetricCounter);
 GAMELIFT_METRICS_DECLARE_TIMER(MetricTimer, "glork", MockEnabled,
                                Aws::GameLift::Metrics::SampleAll());
 GAMELIFT_METRICS_DEFINE_TIMER(MetricTimer);
+
+GAMELIFT_METRICS_DECLARE_GAUGE(
+    MetricRareGauge, "rare", MockEnabled,
+    Aws::GameLift::Metrics::SampleFraction(0.00001f));
+GAMELIFT_METRICS_DEFINE_GAUGE(MetricRareGauge);
+
+GAMELIFT_METRICS_DECLARE_GAUGE(MetricRarerGauge, "rarer", MockEnabled,
+                               Aws::GameLift::Metrics::SampleFraction(1e-7f));
+GAMELIFT_METRICS_DEFINE_GAUGE(MetricRarerGauge);
+
+/**
+ * Formats a value the way packets were formatted with iostreams: fixed point
+ * with `precision` digits, or an integer when the fraction doesn't show.
+ */
+std::string FormatWithStream(double value, int precision,
+                             bool showPositiveSign) {
+  std::ostringstream stream;
+  stream << std::setprecision(precision) << std::fixed;
+  if (showPositiveSign) {
+    stream << std::showpos;
+  }
+  const int64_t valueAsInteger = static_cast<int64_t>(value);
+  if (std::fabs((value - valueAsInteger) * std::pow(10, precision)) >= 0.5) {
+    stream << value;
+  } else {
+    stream << valueAsInteger;
+  }
+  return stream.str();
+}
 } // namespace
 
 TEST_F(PacketBuilderDogStatsDTests, GaugeSet) {
@@ -521,3 +554,97 @@ TEST_F(
                  Stream);
   EXPECT_EQ(Result(), "gaugor:10|g|#foo:bar,a:b\n");
 }
+
+TEST_F(PacketBuilderDogStatsDTests,
+       WhenValueIsExactTie_ThenRoundsLikePrintf) {
+  // 12.5 and 37.5 hundredths are exact in binary, printf rounds them to even.
+  AppendToStream(MetricMessage::TimerSet(MetricTimer::Instance(), 0.125), 2,
+                 {}, {}, Stream);
+  AppendToStream(MetricMessage::TimerSet(MetricTimer::Instance(), 0.375), 2,
+                 {}, {}, Stream);
+  EXPECT_EQ(Result(), "glork:0.12|ms\nglork:0.38|ms\n");
+}
+
+TEST_F(PacketBuilderDogStatsDTests,
+       WhenValueIsJustBelowTie_ThenRoundsDown) {
+  // 2.675 is stored as 2.67499999999999982236431605997495353221893310546875.
+  AppendToStream(MetricMessage::TimerSet(MetricTimer::Instance(), 2.675), 2,
+                 {}, {}, Stream);
+  AppendToStream(MetricMessage::GaugeAdd(MetricGauge::Instance(), -2.675), 2,
+                 {}, {}, Stream);
+  EXPECT_EQ(Result(), "glork:2.67|ms\ngaugor:-2.67|g\n");
+}
+
+TEST_F(PacketBuilderDogStatsDTests, WhenValueIsNotFinite_ThenWritesName) {
+  AppendToStream(MetricMessage::TimerSet(
+                     MetricTimer::Instance(),
+                     std::numeric_limits<double>::quiet_NaN()),
+                 3, {}, {}, Stream);
+  AppendToStream(MetricMessage::TimerSet(
+                     MetricTimer::Instance(),
+                     std::numeric_limits<double>::infinity()),
+                 3, {}, {}, Stream);
+  AppendToStream(MetricMessage::GaugeAdd(
+                     MetricGauge::Instance(),
+                     std::numeric_limits<double>::infinity()),
+                 3, {}, {}, Stream);
+  AppendToStream(MetricMessage::GaugeAdd(
+                     MetricGauge::Instance(),
+                     -std::numeric_limits<double>::infinity()),
+                 3, {}, {}, Stream);
+  EXPECT_EQ(Result(),
+            "glork:nan|ms\nglork:inf|ms\ngaugor:+inf|g\ngaugor:-inf|g\n");
+}
+
+TEST_F(PacketBuilderDogStatsDTests, WhenValueIsNegativeZero_ThenWritesZero) {
+  AppendToStream(MetricMessage::TimerSet(MetricTimer::Instance(), -0.0), 3, {},
+                 {}, Stream);
+  AppendToStream(MetricMessage::GaugeAdd(MetricGauge::Instance(), -0.0), 3, {},
+                 {}, Stream);
+  AppendToStream(MetricMessage::TimerSet(MetricTimer::Instance(), -0.0004), 3,
+                 {}, {}, Stream);
+  EXPECT_EQ(Result(), "glork:0|ms\ngaugor:+0|g\nglork:0|ms\n");
+}
+
+TEST_F(PacketBuilderDogStatsDTests,
+       WhenSampleRateIsSmall_ThenWritesFixedPointRate) {
+  AppendToStream(MetricMessage::GaugeSet(MetricRareGauge::Instance(), 1), 3,
+                 {}, {}, Stream);
+  AppendToStream(MetricMessage::GaugeSet(MetricRarerGauge::Instance(), 1), 3,
+                 {}, {}, Stream);
+  EXPECT_EQ(Result(), "rare:1|g|@0.00001\nrarer:1|g|@0.0000001\n");
+}
+
+TEST_F(PacketBuilderDogStatsDTests,
+       WhenRandomValuesAppended_ThenMatchesStreamFormatting) {
+  std::mt19937_64 Random(20240611);
+  std::uniform_real_distribution<double> Exponent(-6.0, 12.0);
+  std::uniform_int_distribution<int> Precision(0, 8);
+  std::bernoulli_distribution Negative(0.5);
+
+  for (int i = 0; i < 20000; ++i) {
+    double Value = std::pow(10.0, Exponent(Random));
+    if (Negative(Random)) {
+      Value = -Value;
+    }
+    const int FloatPrecision = Precision(Random);
+
+    std::ostringstream Timer;
+    AppendToStream(MetricMessage::TimerSet(MetricTimer::Instance(), Value),
+                   FloatPrecision, {}, {}, Timer);
+    ASSERT_EQ(Timer.str(),
+              "glork:" + FormatWithStream(Value, FloatPrecision, false) +
+                  "|ms\n")
+        << std::setprecision(17) << Value << " at precision "
+        << FloatPrecision;
+
+    std::ostringstream Gauge;
+    AppendToStream(MetricMessage::GaugeAdd(MetricGauge::Instance(), Value),
+                   FloatPrecision, {}, {}, Gauge);
+    ASSERT_EQ(Gauge.str(),
+              "gaugor:" + FormatWithStream(Value, FloatPrecision, true) +
+                  "|g\n")
+        << std::setprecision(17) << Value << " at precision "
+        << FloatPrecision;
+  }
+}
@@ -248,3 +248,86 @@ TEST(PercentilesTests,
   EXPECT_EQ(P98.Type, MetricMessageType::TimerSet);
   EXPECT_NEAR(P98.SubmitDouble.Value, 9689.4, 0.001);
 }
+
+TEST(PercentilesTests,
+     WhenApproximatePercentilesHandleTimers_ThenEstimatesAreWithinAccuracy) {
+  auto Percentiles =
+      Aws::GameLift::Metrics::ApproximatePercentiles(0.5, 0.95, 0.99);
+
+  MockVectorEnqueuer Results;
+  for (int Value = 1; Value <= 10000; ++Value) {
+    auto SetMessage = MetricMessage::TimerSet(MetricTimer::Instance(), Value);
+    Percentiles.HandleMessage(SetMessage, Results);
+  }
+  Percentiles.EmitMetrics(&MetricTimer::Instance(), Results);
+
+  ASSERT_THAT(Results.Values, SizeIs(3));
+
+  MetricMessage P50 = Results.Values[0];
+  EXPECT_THAT(P50.Metric->GetKey(), StrEq("timer.p50"));
+  EXPECT_EQ(P50.Type, MetricMessageType::TimerSet);
+  EXPECT_NEAR(P50.SubmitDouble.Value, 5000, 5000 * 0.01);
+
+  MetricMessage P95 = Results.Values[1];
+  EXPECT_THAT(P95.Metric->GetKey(), StrEq("timer.p95"));
+  EXPECT_NEAR(P95.SubmitDouble.Value, 9500, 9500 * 0.01);
+
+  MetricMessage P99 = Results.Values[2];
+  EXPECT_THAT(P99.Metric->GetKey(), StrEq("timer.p99"));
+  EXPECT_NEAR(P99.SubmitDouble.Value, 9900, 9900 * 0.01);
+
+  // Samples are cleared between capture periods.
+  Results.Values.clear();
+  auto SetMessage = MetricMessage::TimerSet(MetricTimer::Instance(), 42);
+  Percentiles.HandleMessage(SetMessage, Results);
+  Percentiles.EmitMetrics(&MetricTimer::Instance(), Results);
+
+  ASSERT_THAT(Results.Values, SizeIs(3));
+  for (const MetricMessage &Message : Results.Values) {
+    EXPECT_NEAR(Message.SubmitDouble.Value, 42, 42 * 0.01);
+  }
+}
+
+TEST(PercentilesTests,
+     WhenApproximatePercentilesHandleNegativeAndZeroGauges_ThenKeepsOrder) {
+  auto Percentiles =
+      Aws::GameLift::Metrics::ApproximatePercentiles(0.05, 0.5, 0.95);
+
+  MockVectorEnqueuer Results;
+  for (int Value = -100; Value <= 100; ++Value) {
+    auto SetMessage = MetricMessage::GaugeSet(MetricGauge::Instance(), Value);
+    Percentiles.HandleMessage(SetMessage, Results);
+  }
+  Percentiles.EmitMetrics(&MetricGauge::Instance(), Results);
+
+  ASSERT_THAT(Results.Values, SizeIs(3));
+  EXPECT_EQ(Results.Values[0].Type, MetricMessageType::GaugeSet);
+  EXPECT_NEAR(Results.Values[0].SubmitDouble.Value, -90, 90 * 0.01);
+  EXPECT_EQ(Results.Values[1].SubmitDouble.Value, 0);
+  EXPECT_NEAR(Results.Values[2].SubmitDouble.Value, 90, 90 * 0.01);
+}
+
+TEST(PercentilesTests,
+     WhenApproximatePercentilesRangeExceedsBuckets_ThenHighPercentilesHold) {
+  // At 0.01% accuracy, 1 to 1000 spans far more buckets than a sketch keeps,
+  // so the smallest values get folded together.
+  auto Percentiles =
+      Aws::GameLift::Metrics::ApproximatePercentilesWithAccuracy(0.0001, 0.01,
+                                                                 0.9, 0.99);
+
+  MockVectorEnqueuer Results;
+  for (int i = 0; i < 1000; ++i) {
+    // Every value from 1 to 1000, out of order.
+    const int Value = i * 7919 % 1000 + 1;
+    auto SetMessage = MetricMessage::TimerSet(MetricTimer::Instance(), Value);
+    Percentiles.HandleMessage(SetMessage, Results);
+  }
+  Percentiles.EmitMetrics(&MetricTimer::Instance(), Results);
+
+  ASSERT_THAT(Results.Values, SizeIs(3));
+  EXPECT_GT(Results.Values[0].SubmitDouble.Value, 10);
+  EXPECT_LT(Results.Values[0].SubmitDouble.Value,
+            Results.Values[1].SubmitDouble.Value);
+  EXPECT_NEAR(Results.Values[1].SubmitDouble.Value, 900, 900 * 0.0001);
+  EXPECT_NEAR(Results.Values[2].SubmitDouble.Value, 990, 990 * 0.0001);
+}
@@ -0,0 +1,233 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Common.h"
+#include "MetricMacrosTests.h"
+
+#include <aws/gamelift/metrics/DefinitionMacros.h>
+#include <aws/gamelift/metrics/MetricsProcessor.h>
+#include <aws/gamelift/metrics/Samplers.h>
+
+#include <thread>
+#include <vector>
+
+using namespace Aws::GameLift::Metrics;
+using namespace ::testing;
+
+namespace {
+GAMELIFT_METRICS_DECLARE_COUNTER(MetricPacketsIn, "packets_in", MockEnabled,
+                                 Aws::GameLift::Metrics::SampleAdaptive(10, 1));
+GAMELIFT_METRICS_DEFINE_COUNTER(MetricPacketsIn);
+
+int CountSamples(ISampler &Sampler, int Offered) {
+  int Taken = 0;
+  for (int i = 0; i < Offered; ++i) {
+    Taken += Sampler.ShouldTakeSample() ? 1 : 0;
+  }
+  return Taken;
+}
+} // namespace
+
+struct SampleAdaptiveProcessorTests : public PacketSendTest {};
+
+TEST(SamplerTests, WhenSampleEveryN_ThenTakesFirstAndEveryNthSample) {
+  SampleEveryN Sampler(4);
+
+  std::vector<bool> Samples;
+  for (int i = 0; i < 12; ++i) {
+    Samples.emplace_back(Sampler.ShouldTakeSample());
+  }
+
+  EXPECT_THAT(Samples, testing::ElementsAre(true, false, false, false, true,
+                                            false, false, false, true, false,
+                                            false, false));
+  EXPECT_EQ(Sampler.GetN(), 4);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.25f);
+}
+
+TEST(SamplerTests, WhenSampleEveryNBelowTwo_ThenTakesEverySample) {
+  SampleEveryN Zero(0);
+  SampleEveryN One(1);
+
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(Zero.ShouldTakeSample());
+    EXPECT_TRUE(One.ShouldTakeSample());
+  }
+  EXPECT_FLOAT_EQ(Zero.GetSampleRate(), 1.0f);
+  EXPECT_FLOAT_EQ(One.GetSampleRate(), 1.0f);
+}
+
+TEST(SamplerTests, WhenSampleEveryNOnNewThread_ThenThreadCountsSeparately) {
+  SampleEveryN Sampler(3);
+  EXPECT_TRUE(Sampler.ShouldTakeSample());
+  EXPECT_FALSE(Sampler.ShouldTakeSample());
+
+  bool FirstOnThread = false;
+  bool SecondOnThread = true;
+  std::thread Thread([&]() {
+    FirstOnThread = Sampler.ShouldTakeSample();
+    SecondOnThread = Sampler.ShouldTakeSample();
+  });
+  Thread.join();
+
+  EXPECT_TRUE(FirstOnThread);
+  EXPECT_FALSE(SecondOnThread);
+  EXPECT_FALSE(Sampler.ShouldTakeSample());
+  EXPECT_TRUE(Sampler.ShouldTakeSample());
+}
+
+TEST(SamplerTests, WhenSampleFractionsHaveSameSeed_ThenTakeSameSamples) {
+  SampleFraction First(0.5f, 1234);
+  SampleFraction Second(0.5f, 1234);
+
+  std::vector<bool> FirstSamples;
+  std::vector<bool> SecondSamples;
+  for (int i = 0; i < 256; ++i) {
+    FirstSamples.emplace_back(First.ShouldTakeSample());
+    SecondSamples.emplace_back(Second.ShouldTakeSample());
+  }
+
+  EXPECT_EQ(FirstSamples, SecondSamples);
+}
+
+TEST(SamplerTests, WhenSampleFraction_ThenTakesThatFractionOfSamples) {
+  SampleFraction Sampler(0.25f, 42);
+
+  const int SampleCount = 100000;
+  int Taken = 0;
+  for (int i = 0; i < SampleCount; ++i) {
+    Taken += Sampler.ShouldTakeSample() ? 1 : 0;
+  }
+
+  EXPECT_NEAR(static_cast<double>(Taken) / SampleCount, 0.25, 0.01);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.25f);
+}
+
+TEST(SamplerTests, WhenSampleFractionIsZeroOrOne_ThenTakesNoneOrAll) {
+  SampleFraction Never(0.0f, 7);
+  SampleFraction Always(1.0f, 7);
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_FALSE(Never.ShouldTakeSample());
+    EXPECT_TRUE(Always.ShouldTakeSample());
+  }
+}
+
+TEST(SamplerTests, WhenSampleAdaptiveOverMax_ThenLowersRateNextInterval) {
+  SampleAdaptive Sampler(100, 3);
+
+  EXPECT_EQ(CountSamples(Sampler, 10000), 10000);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 1.0f);
+
+  // The rate of the interval just captured is kept until the next sample.
+  Internal::AdvanceSamplerInterval();
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 1.0f);
+
+  const int Taken = CountSamples(Sampler, 10000);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.01f);
+  EXPECT_NEAR(Taken, 100, 40);
+
+  // Same load, same rate.
+  Internal::AdvanceSamplerInterval();
+  CountSamples(Sampler, 10000);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.01f);
+}
+
+TEST(SamplerTests, WhenSampleAdaptiveLoadDrops_ThenTakesEverySample) {
+  SampleAdaptive Sampler(100, 3);
+  CountSamples(Sampler, 1000);
+  Internal::AdvanceSamplerInterval();
+  CountSamples(Sampler, 1000);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.1f);
+
+  // Sampled at the rate set from the previous, busier interval.
+  Internal::AdvanceSamplerInterval();
+  CountSamples(Sampler, 50);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.1f);
+
+  Internal::AdvanceSamplerInterval();
+  EXPECT_EQ(CountSamples(Sampler, 50), 50);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 1.0f);
+
+  // An idle interval in between also resets the rate.
+  Internal::AdvanceSamplerInterval();
+  CountSamples(Sampler, 1000);
+  Internal::AdvanceSamplerInterval();
+  Internal::AdvanceSamplerInterval();
+  EXPECT_TRUE(Sampler.ShouldTakeSample());
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 1.0f);
+}
+
+TEST(SamplerTests, WhenSampleAdaptiveOnSeveralThreads_ThenCountsAllThreads) {
+  SampleAdaptive Sampler(100, 3);
+
+  std::vector<std::thread> Threads;
+  for (int i = 0; i < 4; ++i) {
+    Threads.emplace_back([&Sampler] { CountSamples(Sampler, 1000); });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  // Threads that have exited still count towards the interval they sampled in.
+  Internal::AdvanceSamplerInterval();
+  Sampler.ShouldTakeSample();
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.025f);
+}
+
+TEST(SamplerTests, WhenSampleAdaptiveMaxBelowOne_ThenTargetsOneSample) {
+  SampleAdaptive Sampler(0, 3);
+  EXPECT_EQ(Sampler.GetMaxSamplesPerInterval(), 1);
+
+  CountSamples(Sampler, 4);
+  Internal::AdvanceSamplerInterval();
+  CountSamples(Sampler, 1);
+  EXPECT_FLOAT_EQ(Sampler.GetSampleRate(), 0.25f);
+}
+
+TEST_F(SampleAdaptiveProcessorTests,
+       WhenRateAdapts_ThenCaptureReportsRateSamplesWereTakenAt) {
+  Aws::GameLift::Metrics::MetricsSettings Settings;
+  Settings.SendPacketCallback = MockSend;
+  Settings.CaptureIntervalSec = 0;
+  MetricsProcessor Processor(Settings);
+
+  auto &Metric = MetricPacketsIn::Instance();
+  const auto OfferSamples = [&](int Offered) {
+    for (int i = 0; i < Offered; ++i) {
+      if (Metric.GetSampler().ShouldTakeSample()) {
+        Processor.Enqueue(MetricMessage::CounterAdd(Metric, 1));
+      }
+    }
+  };
+
+  OfferSamples(100);
+  Processor.ProcessMetricsNow();
+  EXPECT_THAT(OutputPackets, ElementsAre(MakeResult("packets_in:100|c\n", 18)));
+
+  ClearOutputPackets();
+  OfferSamples(100);
+  Processor.ProcessMetricsNow();
+  ASSERT_THAT(OutputPackets, SizeIs(1));
+  EXPECT_THAT(std::get<0>(OutputPackets[0]),
+              AllOf(StartsWith("packets_in:"), EndsWith("|c|@0.1\n")));
+
+  // Back under the limit, every sample is taken again from the interval after.
+  OfferSamples(5);
+  Processor.ProcessMetricsNow();
+  ClearOutputPackets();
+  OfferSamples(5);
+  Processor.ProcessMetricsNow();
+  EXPECT_THAT(OutputPackets, ElementsAre(MakeResult("packets_in:5|c\n", 16)));
+}
@@ -0,0 +1,107 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <aws/gamelift/metrics/StatsDClient.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using Aws::GameLift::Metrics::StatsDClient;
+
+namespace {
+constexpr const char *LocalHost = "127.0.0.1";
+} // namespace
+
+class StatsDClientTests : public ::testing::Test {
+protected:
+  StatsDClientTests()
+      : Receiver(IoService, asio::ip::udp::endpoint(
+                                asio::ip::address::from_string(LocalHost), 0)) {
+    Receiver.set_option(asio::socket_base::receive_buffer_size(1 << 20));
+    Receiver.non_blocking(true);
+  }
+
+  int GetPort() const { return Receiver.local_endpoint().port(); }
+
+  // Receives up to Count packets, waiting at most a few seconds for them.
+  std::vector<std::string> Receive(size_t Count) {
+    std::vector<std::string> Packets;
+    char Buffer[2048];
+    const auto Deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (Packets.size() < Count &&
+           std::chrono::steady_clock::now() < Deadline) {
+      asio::error_code Error;
+      const size_t Size = Receiver.receive(asio::buffer(Buffer), 0, Error);
+      if (Error) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
+      }
+      Packets.emplace_back(Buffer, Size);
+    }
+    return Packets;
+  }
+
+  static void Send(StatsDClient &Client, const std::string &Packet) {
+    Client.Send(Packet.data(), static_cast<int>(Packet.size()));
+  }
+
+  asio::io_service IoService;
+  asio::ip::udp::socket Receiver;
+};
+
+TEST_F(StatsDClientTests,
+       WhenMoreThanOneBatchSent_ThenAllPacketsArriveInOrder) {
+  const size_t PacketCount = StatsDClient::MAX_BATCH_PACKETS * 2 + 5;
+  StatsDClient Client(LocalHost, GetPort());
+
+  std::vector<std::string> Expected;
+  for (size_t i = 0; i < PacketCount; ++i) {
+    Expected.emplace_back("packet:" + std::to_string(i) + "|c\n");
+    Send(Client, Expected.back());
+  }
+  Client.Flush();
+
+  EXPECT_EQ(Receive(PacketCount), Expected);
+  EXPECT_EQ(Client.GetDroppedPacketCount(), 0u);
+}
+
+TEST_F(StatsDClientTests, WhenOnePacketFails_ThenOnlyItIsDroppedAndCounted) {
+  StatsDClient Client(LocalHost, GetPort());
+
+  // Larger than any UDP datagram, so the socket rejects it.
+  Send(Client, "before:1|c\n");
+  Send(Client, std::string(70000, 'x'));
+  Send(Client, "after:1|c\n");
+  Client.Flush();
+
+  EXPECT_THAT(Receive(2), ElementsAre("before:1|c\n", "after:1|c\n"));
+  EXPECT_EQ(Client.GetDroppedPacketCount(), 1u);
+
+  Send(Client, std::string(70000, 'x'));
+  Client.Flush();
+  EXPECT_EQ(Client.GetDroppedPacketCount(), 2u);
+}
+
+TEST_F(StatsDClientTests, WhenDestroyed_ThenQueuedPacketsAreSent) {
+  {
+    StatsDClient Client(LocalHost, GetPort());
+    Send(Client, "queued:1|c\n");
+  }
+
+  EXPECT_THAT(Receive(1), ElementsAre("queued:1|c\n"));
+}
@@ -0,0 +1,116 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "MetricMacrosTests.h"
+#include "MockDerivedMetric.h"
+
+#include <vector>
+
+#include <aws/gamelift/metrics/DefinitionMacros.h>
+#include <aws/gamelift/metrics/Samplers.h>
+#include <aws/gamelift/metrics/Summary.h>
+
+using namespace ::testing;
+
+namespace {
+GAMELIFT_METRICS_DECLARE_GAUGE(MetricGauge, "gauge", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll());
+GAMELIFT_METRICS_DEFINE_GAUGE(MetricGauge);
+
+GAMELIFT_METRICS_DECLARE_TIMER(MetricTimer, "timer", MockEnabled,
+                               Aws::GameLift::Metrics::SampleAll());
+GAMELIFT_METRICS_DEFINE_TIMER(MetricTimer);
+} // namespace
+
+TEST(SummaryTests, GivenTimer_WhenSetCalled_ThenEmitsCountSumMinMax) {
+  std::vector<MetricMessage> Messages{
+      {MetricMessage::TimerSet(MetricTimer::Instance(), 15),
+       MetricMessage::TimerSet(MetricTimer::Instance(), 30),
+       MetricMessage::TimerSet(MetricTimer::Instance(), 40),
+       MetricMessage::TimerSet(MetricTimer::Instance(), 5)}};
+
+  Aws::GameLift::Metrics::Summary Summary;
+
+  MockVectorEnqueuer Results;
+  for (auto &Message : Messages) {
+    Summary.HandleMessage(Message, Results);
+  }
+  Summary.EmitMetrics(&MetricTimer::Instance(), Results);
+
+  ASSERT_THAT(Results.Values, SizeIs(4));
+  EXPECT_THAT(Results.Values[0].Metric->GetKey(), StrEq("timer.count"));
+  EXPECT_THAT(Results.Values[1].Metric->GetKey(), StrEq("timer.sum"));
+  EXPECT_THAT(Results.Values[2].Metric->GetKey(), StrEq("timer.min"));
+  EXPECT_THAT(Results.Values[3].Metric->GetKey(), StrEq("timer.max"));
+  for (const MetricMessage &Message : Results.Values) {
+    EXPECT_TRUE(Message.IsTimer());
+  }
+  EXPECT_EQ(Results.Values[0].SubmitDouble.Value, 4);
+  EXPECT_EQ(Results.Values[1].SubmitDouble.Value, 90);
+  EXPECT_EQ(Results.Values[2].SubmitDouble.Value, 5);
+  EXPECT_EQ(Results.Values[3].SubmitDouble.Value, 40);
+}
+
+TEST(SummaryTests, GivenGauge_WhenSetAndAddCalled_ThenSummarizesGaugeValues) {
+  std::vector<MetricMessage> Messages{
+      {MetricMessage::GaugeSet(MetricGauge::Instance(), 2),
+       MetricMessage::GaugeAdd(MetricGauge::Instance(), 2),
+       MetricMessage::GaugeAdd(MetricGauge::Instance(), 2),
+       MetricMessage::GaugeSet(MetricGauge::Instance(), 4),
+       MetricMessage::GaugeAdd(MetricGauge::Instance(), 1),
+       MetricMessage::GaugeAdd(MetricGauge::Instance(), -4),
+       MetricMessage::GaugeAdd(MetricGauge::Instance(), 6),
+       MetricMessage::GaugeAdd(MetricGauge::Instance(), 2)}};
+
+  auto Summary = Aws::GameLift::Metrics::Summary().WithStdDev(true);
+
+  MockVectorEnqueuer Results;
+  for (auto &Message : Messages) {
+    Summary.HandleMessage(Message, Results);
+  }
+  Summary.EmitMetrics(&MetricGauge::Instance(), Results);
+
+  // Gauge values 2, 4, 6, 4, 5, 1, 7, 9: mean 4.75.
+  ASSERT_THAT(Results.Values, SizeIs(5));
+  for (const MetricMessage &Message : Results.Values) {
+    EXPECT_EQ(Message.Type, MetricMessageType::GaugeSet);
+  }
+  EXPECT_EQ(Results.Values[0].SubmitDouble.Value, 8);
+  EXPECT_EQ(Results.Values[1].SubmitDouble.Value, 38);
+  EXPECT_EQ(Results.Values[2].SubmitDouble.Value, 1);
+  EXPECT_EQ(Results.Values[3].SubmitDouble.Value, 9);
+  EXPECT_THAT(Results.Values[4].Metric->GetKey(), StrEq("gauge.stddev"));
+  EXPECT_NEAR(Results.Values[4].SubmitDouble.Value, 2.4367, 0.0001);
+}
+
+TEST(SummaryTests, WhenEmittedTwice_ThenSecondPeriodStartsOver) {
+  Aws::GameLift::Metrics::Summary Summary;
+  MockVectorEnqueuer Results;
+
+  auto FirstMessage = MetricMessage::TimerSet(MetricTimer::Instance(), 100);
+  Summary.HandleMessage(FirstMessage, Results);
+  Summary.EmitMetrics(&MetricTimer::Instance(), Results);
+  Results.Values.clear();
+
+  // Nothing recorded, nothing emitted.
+  Summary.EmitMetrics(&MetricTimer::Instance(), Results);
+  EXPECT_THAT(Results.Values, IsEmpty());
+
+  auto SecondMessage = MetricMessage::TimerSet(MetricTimer::Instance(), 7);
+  Summary.HandleMessage(SecondMessage, Results);
+  Summary.EmitMetrics(&MetricTimer::Instance(), Results);
+
+  ASSERT_THAT(Results.Values, SizeIs(4));
+  EXPECT_EQ(Results.Values[0].SubmitDouble.Value, 1);
+  EXPECT_EQ(Results.Values[1].SubmitDouble.Value, 7);
+  EXPECT_EQ(Results.Values[2].SubmitDouble.Value, 7);
+  EXPECT_EQ(Results.Values[3].SubmitDouble.Value, 7);
+}
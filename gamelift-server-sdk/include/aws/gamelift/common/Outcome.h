@@ -125,5 +125,11 @@ typedef Outcome<Aws::GameLift::Server::Model::DescribePlayerSessionsResult, Game
 typedef Outcome<Aws::GameLift::Server::Model::StartMatchBackfillResult, GameLiftError> StartMatchBackfillOutcome;
 typedef Outcome<Aws::GameLift::Server::Model::GetComputeCertificateResult, GameLiftError> GetComputeCertificateOutcome;
 typedef Outcome<Aws::GameLift::Server::Model::GetFleetRoleCredentialsResult, GameLiftError> GetFleetRoleCredentialsOutcome;
+
+#ifdef GAMELIFT_USE_STD
+typedef std::future<DescribePlayerSessionsOutcome> DescribePlayerSessionsOutcomeCallable;
+typedef std::future<StartMatchBackfillOutcome> StartMatchBackfillOutcomeCallable;
+typedef std::future<GetFleetRoleCredentialsOutcome> GetFleetRoleCredentialsOutcomeCallable;
+#endif
 } // namespace GameLift
 } // namespace Aws
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/GameLiftCommonState.h>
+#include <aws/gamelift/internal/model/request/WebSocketGetFleetRoleCredentialsRequest.h>
 #include <aws/gamelift/internal/network/GameLiftWebSocketClientManager.h>
 #include <aws/gamelift/internal/network/IGameLiftMessageHandler.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
@@ -24,13 +25,18 @@
 #include <aws/gamelift/internal/network/callback/StartMatchBackfillCallback.h>
 #include <aws/gamelift/internal/network/callback/TerminateProcessCallback.h>
 #include <aws/gamelift/internal/network/callback/UpdateGameSessionCallback.h>
+#include <aws/gamelift/internal/retry/AsyncRetryingCallable.h>
+#include <aws/gamelift/internal/retry/JitteredGeometricBackoffRetryStrategy.h>
+#include <aws/gamelift/internal/util/TaskScheduler.h>
+#include <aws/gamelift/internal/util/ThreadPool.h>
 #include <aws/gamelift/server/GameLiftServerAPI.h>
 #include <aws/gamelift/server/model/ServerParameters.h>
 #include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/StopMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/UpdateGameSession.h>
-#include <condition_variable>
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 namespace Aws {
 namespace GameLift {
@@ -65,6 +71,14 @@ private:
     static constexpr const int HEALTHCHECK_MAX_JITTER_MILLIS = 10 * 1000;
     static constexpr const int HEALTHCHECK_TIMEOUT_MILLIS = HEALTHCHECK_INTERVAL_MILLIS - HEALTHCHECK_MAX_JITTER_MILLIS;
 
+    // Asynchronous sends poll for an in-progress reconnect on a timer, for up to 3 minutes
+    static constexpr const int WAIT_FOR_RECONNECT_RETRY_DELAY_MILLIS = 5 * 1000;
+    static constexpr const int WAIT_FOR_RECONNECT_MAX_RETRIES = 180 * 1000 / WAIT_FOR_RECONNECT_RETRY_DELAY_MILLIS;
+    static constexpr const int MAX_FAILURES_BEFORE_RECONNECT = 2;
+
+    // Health check callbacks run on this many SDK threads, unless ProcessParameters provides an executor
+    static constexpr const int CALLBACK_THREAD_POOL_SIZE = 4;
+
     void GetOverrideParams(char **webSocketUrl,
                            char **authToken,
                            char **processId,
@@ -79,8 +93,12 @@ private:
                            char *accessKey,
                            char *secretKey,
                            char *sessionToken);
+    // Heartbeats run on the task scheduler: each beat reports health and schedules the next one.
+    void StartHealthCheck();
+    void HealthCheck(int generation);
     void ReportHealth();
-    void HealthCheck();
+    // Sends the heartbeat for one beat, unless it was already sent (callback result vs. deadline).
+    void ReportHealthStatus(const std::shared_ptr<bool> &healthReported, bool health);
     int GetNextHealthCheckIntervalMillis();
 
 #ifdef GAMELIFT_USE_STD
@@ -136,6 +154,7 @@ private:
     std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> m_onUpdateGameSession;
     std::function<void()> m_onProcessTerminate;
     std::function<bool()> m_onHealthCheck;
+    Aws::GameLift::Server::CallbackExecutor m_callbackExecutor;
 #else
 public:
     template <class WrapperT> static Internal::InitSDKOutcome CreateInstance() { return ConstructInternal(std::make_shared<WrapperT>()); }
@@ -199,6 +218,8 @@ private:
     void *m_updateGameSessionState;
     void *m_processTerminateState;
     void *m_healthCheckState;
+    Aws::GameLift::Server::CallbackExecutorFn m_callbackExecutor;
+    void *m_callbackExecutorState;
 
     void *startGameSessionState;
     void *processTerminateState;
@@ -208,15 +229,62 @@ private:
 public:
     GetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request);
 
+    // Non-blocking variants of the calls above. onComplete is invoked exactly once, on the SDK's task
+    // scheduler thread, with the same outcome the blocking call would have returned.
+    void AcceptPlayerSessionAsync(const std::string &playerSessionId, const std::function<void(const GenericOutcome &)> &onComplete);
+
+    void RemovePlayerSessionAsync(const std::string &playerSessionId, const std::function<void(const GenericOutcome &)> &onComplete);
+
+    void DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                     const std::function<void(const DescribePlayerSessionsOutcome &)> &onComplete);
+
+    void StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                 const std::function<void(const StartMatchBackfillOutcome &)> &onComplete);
+
+    void GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                      const std::function<void(const GetFleetRoleCredentialsOutcome &)> &onComplete);
+
+    // Sends the message with the same retry and reconnect behaviour as SendSocketMessageWithRetries,
+    // but waits for responses and backoff delays on the task scheduler instead of the calling thread.
+    void SendSocketMessageWithRetriesAsync(const std::shared_ptr<Message> &message, const std::function<void(const GenericOutcome &)> &onComplete);
+
     void SetGlobalProcessor(Aws::GameLift::Metrics::IMetricsProcessor* processor);
 
+    // Replaces how ReconnectWebSocket() creates the new wrapper, so tests can reconnect to a mock.
+    void SetWebSocketClientWrapperFactory(const std::function<std::shared_ptr<IWebSocketClientWrapper>()> &webSocketClientWrapperFactory);
+
     // When within 15 minutes of expiration we retrieve new instance role credentials
     static constexpr const time_t INSTANCE_ROLE_CREDENTIAL_TTL_MIN = 60 * 15;
 
 private:
+    struct AsyncSendOperation;
+
     bool AssertNetworkInitialized();
     void SetUpCallbacks();
+    // Replaces the connection that failedManager was sending through. Returns true without reconnecting
+    // if another caller already replaced it, so concurrent callers don't tear down each other's connection.
+    bool ReconnectWebSocket(const std::shared_ptr<GameLiftWebSocketClientManager> &failedManager);
+    // Read the current manager and wrapper, which ReconnectWebSocket() may replace from another thread.
+    std::shared_ptr<GameLiftWebSocketClientManager> GetWebSocketClientManager() const;
+    std::shared_ptr<IWebSocketClientWrapper> GetCurrentWebSocketClientWrapper() const;
     static void DetectGameLiftTools();
+    // Runs a developer callback on the executor from ProcessParameters, or else on threadPool.
+    void DispatchCallback(ThreadPool *threadPool, const char *callbackName, const std::function<void()> &callback);
+
+    void AttemptAsyncSend(const std::shared_ptr<AsyncSendOperation> &operation, const AsyncRetryingCallable::AttemptCallback &done);
+    // Records the outcome of one attempt and calls done with true if retrying should stop. May reconnect
+    // first, in which case done is called once the reconnect has finished.
+    void OnAsyncSendAttemptComplete(const std::shared_ptr<AsyncSendOperation> &operation, const GenericOutcome &outcome,
+                                    const AsyncRetryingCallable::AttemptCallback &done);
+
+    GenericOutcome ValidatePlayerSessionRequest(const std::string &playerSessionId);
+    GenericOutcome ValidateStartMatchBackfillRequest(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest);
+    static DescribePlayerSessionsOutcome ToDescribePlayerSessionsOutcome(const GenericOutcome &rawResponse);
+    static StartMatchBackfillOutcome ToStartMatchBackfillOutcome(const GenericOutcome &rawResponse);
+    // Returns true if the outcome is known without calling the service (cached credentials, or a
+    // request that can't succeed), in which case it is written to outcome.
+    bool ResolveFleetRoleCredentialsLocally(WebSocketGetFleetRoleCredentialsRequest &webSocketRequest, GetFleetRoleCredentialsOutcome &outcome);
+    GetFleetRoleCredentialsOutcome ToGetFleetRoleCredentialsOutcome(const std::string &roleArn, const GenericOutcome &rawResponse);
 
     bool m_processReady;
 
@@ -225,8 +293,14 @@ private:
 
     long m_terminationTime;
 
-    GameLiftWebSocketClientManager *m_webSocketClientManager;
+    // Guards m_webSocketClientManager and m_webSocketClientWrapper, which ReconnectWebSocket() replaces
+    // while other threads are sending.
+    mutable std::mutex m_webSocketMutex;
+    // Serializes ReconnectWebSocket() between the calling threads and the async reconnect thread.
+    std::mutex m_reconnectMutex;
+    std::shared_ptr<GameLiftWebSocketClientManager> m_webSocketClientManager;
     std::shared_ptr<IWebSocketClientWrapper> m_webSocketClientWrapper;
+    std::function<std::shared_ptr<IWebSocketClientWrapper>()> m_webSocketClientWrapperFactory;
 
     // Callbacks
     std::unique_ptr<CreateGameSessionCallback> m_createGameSessionCallback;
@@ -243,17 +317,39 @@ private:
     std::string m_fleetId;
     std::string m_hostId;
     std::string m_processId;
+    // Guards m_onManagedEC2OrContainers and m_instanceRoleResultCache. Synchronous calls use them on the
+    // caller's thread, asynchronous completions on the task scheduler thread.
+    std::mutex m_instanceRoleMutex;
     // Assume we're on managed EC2, if GetFleetRoleCredentials fails we know to set this to false
     bool m_onManagedEC2OrContainers = true;
     std::map<std::string, GetFleetRoleCredentialsResult> m_instanceRoleResultCache;
 
-    std::unique_ptr<std::thread> m_healthCheckThread;
-    std::condition_variable m_healthCheckConditionVariable;
-    std::mutex m_healthCheckMutex;
-    bool m_healthCheckInterrupted;
+    // Bumped each time ProcessReady() starts heartbeats, so a chain of beats left over from an earlier
+    // ProcessReady() stops. Only used from the task scheduler thread.
+    int m_healthCheckGeneration;
+    // Set while the developer health check callback is running. Shared with the dispatched callback,
+    // which may finish after the SDK is destroyed.
+    std::shared_ptr<std::atomic<bool>> m_healthCheckInFlight;
 
     // GlobalProcessor reference for metrics
     Aws::GameLift::Metrics::IMetricsProcessor* m_globalProcessor;
+
+    // Run developer callbacks when ProcessParameters doesn't provide an executor. Game session and
+    // terminate callbacks go to a single thread, in the order they arrived, so they are never held up
+    // behind (or run alongside) slow health checks.
+    std::unique_ptr<ThreadPool> m_callbackThreadPool;
+    std::unique_ptr<ThreadPool> m_lifecycleCallbackThreadPool;
+
+    // Runs heartbeats, asynchronous request completions and their retry timers. Shared with callbacks
+    // that may finish after the SDK is destroyed, posting to it is ignored once it has shut down.
+    std::shared_ptr<TaskScheduler> m_taskScheduler;
+    // Only used from the task scheduler thread
+    JitteredGeometricBackoffRetryStrategy m_asyncRetryStrategy;
+
+    // Runs the reconnect for asynchronous sends, since it blocks until the new connection is up. Joined
+    // on destruction. m_asyncReconnectInProgress is only used from the task scheduler thread.
+    std::thread m_asyncReconnectThread;
+    bool m_asyncReconnectInProgress;
 };
 
 } // namespace Internal
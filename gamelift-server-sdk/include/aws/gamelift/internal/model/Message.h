@@ -63,11 +63,26 @@ public:
      */
     std::string Serialize() const override;
 
+    /**
+     * Serialize the Message into the given buffer, replacing its contents. Lets callers reuse one
+     * buffer across messages instead of allocating a new string for every send. Returns false (and
+     * leaves the buffer empty) if serialization fails.
+     */
+    bool Serialize(rapidjson::StringBuffer &buffer) const;
+
     /**
      * Deserialize the given json string and populate the member variables.
      */
     bool Deserialize(const std::string &jsonString) override;
 
+    /**
+     * Given RapidJson Value deserialize and populate this message's member variables.
+     * Subclasses of Message should override this function in order to allow for polymorphic
+     * deserialization. Public so that a document parsed once on receipt can be handed to every
+     * consumer without re-parsing the raw json string.
+     */
+    virtual bool Deserialize(const rapidjson::Value &obj);
+
     friend std::ostream &operator<<(std::ostream &os, const Message &message);
 
 protected:
@@ -78,13 +93,6 @@ protected:
      */
     virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
 
-    /**
-     * Given RapidJson Value deserialize and populate this message's member variables.
-     * Subclasses of Message should override this function in order to allow for polymorphic
-     * deserialization.
-     */
-    virtual bool Deserialize(const rapidjson::Value &obj);
-
 private:
     static constexpr const char *ACTION = "Action";
     static constexpr const char *REQUEST_ID = "RequestId";
@@ -38,6 +38,9 @@ public:
                                           const std::string &fleetId, const std::map<std::string, std::string> &sigV4QueryParameters = {});
     // Messages are synchronously sent and a response is waited for.
     GenericOutcome SendSocketMessage(Message &message);
+    // Messages are sent without waiting. onResponse is invoked once the response arrives or the
+    // request fails, typically on one of the websocket threads.
+    void SendSocketMessageAsync(Message &message, const std::function<void(const GenericOutcome &)> &onResponse);
     void Disconnect();
 
 private:
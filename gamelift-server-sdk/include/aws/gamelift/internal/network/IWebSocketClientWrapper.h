@@ -13,6 +13,7 @@
 #include <aws/gamelift/common/Outcome.h>
 #include <aws/gamelift/internal/model/Uri.h>
 #include <functional>
+#include <rapidjson/document.h>
 #include <string>
 
 namespace Aws {
@@ -26,8 +27,23 @@ class IWebSocketClientWrapper {
 public:
     virtual Aws::GameLift::GenericOutcome Connect(const Uri &uri) = 0;
     virtual Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) = 0;
+    // Sends a message that was serialized into a caller-owned buffer. Wrappers that can hand the bytes
+    // straight to the socket should override this; by default it falls back to the std::string overload.
+    virtual Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const char *message, size_t length) {
+        return SendSocketMessage(requestId, std::string(message, length));
+    }
+    // Sends a message without waiting for the response. onResponse is invoked exactly once, with the
+    // response or with an error if the message could not be sent or timed out. Wrappers that can
+    // complete requests from their socket threads should override this; by default it blocks on the
+    // synchronous send.
+    virtual void SendSocketMessageAsync(const std::string &requestId, const char *message, size_t length,
+                                        const std::function<void(const GenericOutcome &)> &onResponse) {
+        onResponse(SendSocketMessage(requestId, message, length));
+    }
+    // Closes the connection. Requests still waiting for a response complete with a retriable error.
     virtual void Disconnect() = 0;
-    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) = 0;
+    // Callbacks receive the already-parsed message, so an inbound frame is only parsed once.
+    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value &)> &callback) = 0;
     virtual bool IsConnected() = 0;
 
     virtual ~IWebSocketClientWrapper() = default;
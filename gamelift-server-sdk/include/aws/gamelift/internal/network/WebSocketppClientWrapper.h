@@ -12,8 +12,10 @@
 #pragma once
 
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/util/RequestId.h>
 #include <condition_variable>
 #include <thread>
+#include <unordered_map>
 #include <websocketpp/client.hpp>
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
@@ -39,8 +41,11 @@ public:
 
     Aws::GameLift::GenericOutcome Connect(const Uri &uri) override;
     Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) override;
+    Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const char *message, size_t length) override;
+    void SendSocketMessageAsync(const std::string &requestId, const char *message, size_t length,
+                                const std::function<void(const GenericOutcome &)> &onResponse) override;
     void Disconnect() override;
-    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) override;
+    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value &)> &callback) override;
     bool IsConnected() override;
 
     ~WebSocketppClientWrapper();
@@ -65,14 +70,37 @@ private:
     websocketpp::lib::error_code m_fail_error_code;
     websocketpp::http::status_code::value m_fail_response_code;
 
-    std::map<std::string, std::function<GenericOutcome(std::string)>> m_eventHandlers;
-    std::mutex m_requestToPromiseLock;
-    std::map<std::string, std::promise<GenericOutcome>> m_requestIdToPromise;
+    // A request waiting for its response. Synchronous sends complete a promise from onResponse,
+    // asynchronous sends also arm a timer that fails the request if no response arrives in time.
+    struct PendingRequest {
+        std::function<void(const GenericOutcome &)> onResponse;
+        WebSocketppClientType::timer_ptr timeoutTimer;
+    };
+
+    // In-flight requests are spread over a fixed set of shards by request id, each with its own lock,
+    // so socket threads completing responses rarely contend with game threads issuing requests.
+    static constexpr const size_t PENDING_REQUEST_SHARD_COUNT = 16;
+    static constexpr const size_t PENDING_REQUEST_SHARD_CAPACITY = 16;
+    typedef std::unordered_map<RequestId, PendingRequest, RequestId::Hash> PendingRequestMap;
+    struct PendingRequestShard {
+        std::mutex lock;
+        PendingRequestMap requests;
+    };
+
+    std::map<std::string, std::function<GenericOutcome(const rapidjson::Value &)>> m_eventHandlers;
+    PendingRequestShard m_pendingRequestShards[PENDING_REQUEST_SHARD_COUNT];
     Uri m_uri;
 
     // Helper methods
     WebSocketppClientType::connection_ptr PerformConnect(const Uri &uri, websocketpp::lib::error_code &error);
-    Aws::GameLift::GenericOutcome SendSocketMessageAsync(const std::string &message);
+    Aws::GameLift::GenericOutcome WriteSocketMessage(const char *message, size_t length);
+    PendingRequestShard &GetPendingRequestShard(const RequestId &requestId);
+    bool AddPendingRequest(const RequestId &requestId, const PendingRequest &pendingRequest);
+    // Removes the request and returns its response handler, or an empty function if the request
+    // was already completed.
+    std::function<void(const GenericOutcome &)> TakePendingRequest(const RequestId &requestId);
+    // Completes every request still waiting for a response with the given error.
+    void FailPendingRequests(GAMELIFT_ERROR_TYPE errorType);
 
     // CallBacks
     void OnConnected(websocketpp::connection_hdl connection);
@@ -38,6 +38,7 @@ public:
      * @return
      */
     GenericOutcome OnStartGameSession(const std::string &data);
+    GenericOutcome OnStartGameSession(const rapidjson::Value &data);
 
     // Constants
     static constexpr const char *CREATE_GAME_SESSION = "CreateGameSession";
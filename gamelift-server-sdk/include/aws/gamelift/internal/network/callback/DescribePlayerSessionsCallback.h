@@ -29,6 +29,7 @@ public:
 
     // Methods
     GenericOutcome OnDescribePlayerSessions(const std::string &data);
+    GenericOutcome OnDescribePlayerSessions(const rapidjson::Value &data);
 
     static constexpr const char *DESCRIBE_PLAYER_SESSIONS = "DescribePlayerSessions";
 };
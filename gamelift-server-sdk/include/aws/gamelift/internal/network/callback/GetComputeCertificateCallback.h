@@ -30,6 +30,7 @@ public:
 
     // Methods
     GenericOutcome OnGetComputeCertificateCallback(const std::string &data);
+    GenericOutcome OnGetComputeCertificateCallback(const rapidjson::Value &data);
 
     static constexpr const char *GET_COMPUTE_CERTIFICATE = "GetComputeCertificate";
 };
@@ -30,6 +30,7 @@ public:
 
     // Methods
     GenericOutcome OnGetFleetRoleCredentials(const std::string &data);
+    GenericOutcome OnGetFleetRoleCredentials(const rapidjson::Value &data);
 
     static constexpr const char *GET_FLEET_ROLE_CREDENTIALS = "GetFleetRoleCredentials";
 };
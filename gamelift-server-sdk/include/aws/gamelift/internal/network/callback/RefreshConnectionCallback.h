@@ -31,6 +31,7 @@ public:
 
     // Methods
     GenericOutcome OnRefreshConnection(const std::string &data);
+    GenericOutcome OnRefreshConnection(const rapidjson::Value &data);
 
     static constexpr const char *REFRESH_CONNECTION = "RefreshConnection";
     IGameLiftMessageHandler *m_gameLiftMessageHandler;
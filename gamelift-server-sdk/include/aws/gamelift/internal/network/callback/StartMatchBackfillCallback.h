@@ -29,6 +29,7 @@ public:
 
     // Methods
     GenericOutcome OnStartMatchBackfill(const std::string &data);
+    GenericOutcome OnStartMatchBackfill(const rapidjson::Value &data);
 
     static constexpr const char *START_MATCH_BACKFILL = "StartMatchBackfill";
 };
@@ -32,6 +32,7 @@ public:
 
     // Methods
     GenericOutcome OnTerminateProcess(const std::string &data);
+    GenericOutcome OnTerminateProcess(const rapidjson::Value &data);
 
     static constexpr const char *TERMINATE_PROCESS = "TerminateProcess";
 
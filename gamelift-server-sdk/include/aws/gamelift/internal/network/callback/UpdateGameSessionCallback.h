@@ -38,6 +38,7 @@ public:
      * @return
      */
     GenericOutcome OnUpdateGameSession(const std::string &data);
+    GenericOutcome OnUpdateGameSession(const rapidjson::Value &data);
 
     // Constants
     static constexpr const char *UPDATE_GAME_SESSION = "UpdateGameSession";
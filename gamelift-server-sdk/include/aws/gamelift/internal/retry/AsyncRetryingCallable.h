@@ -0,0 +1,73 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/retry/RetryStrategy.h>
+#include <aws/gamelift/internal/util/TaskScheduler.h>
+#include <memory>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Timer-driven counterpart of RetryingCallable. Each attempt reports its result through a callback
+ * instead of returning it, and the delay between attempts is a TaskScheduler timer, so no thread
+ * sleeps while a request backs off.
+ */
+class AsyncRetryingCallable {
+public:
+    // Reports the result of one attempt: true to stop, false to retry after the strategy's delay.
+    typedef std::function<void(bool)> AttemptCallback;
+    // Performs one attempt and eventually invokes the callback exactly once. The callback must be
+    // invoked on the TaskScheduler thread; attempts that complete elsewhere should Post() back first.
+    typedef std::function<void(const AttemptCallback &)> AsyncCallable;
+
+    class Builder {
+    public:
+        Builder();
+
+        Builder &WithRetryStrategy(RetryStrategy *retryStrategy);
+        Builder &WithTaskScheduler(TaskScheduler *taskScheduler);
+        Builder &WithCallable(const AsyncCallable &callable);
+        // Invoked once retrying ends, with true if the last attempt asked to stop and false if the
+        // strategy ran out of retries.
+        Builder &WithOnComplete(const std::function<void(bool)> &onComplete);
+        AsyncRetryingCallable Build() const;
+
+    private:
+        AsyncCallable m_callable;
+        std::function<void(bool)> m_onComplete;
+        // Note: The RetryStrategy and TaskScheduler are not owned by the builder or the AsyncRetryingCallable
+        RetryStrategy *m_retryStrategy;
+        TaskScheduler *m_taskScheduler;
+    };
+
+    // Schedules the first attempt and returns immediately. Attempts, and the retry strategy, only
+    // ever run on the TaskScheduler thread.
+    void call();
+
+private:
+    struct State;
+
+    AsyncRetryingCallable(RetryStrategy &retryStrategy, TaskScheduler &taskScheduler, const AsyncCallable &callable,
+                          const std::function<void(bool)> &onComplete);
+
+    static void Attempt(const std::shared_ptr<State> &state);
+    static void OnAttemptComplete(const std::shared_ptr<State> &state, bool done);
+
+    std::shared_ptr<State> m_state;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
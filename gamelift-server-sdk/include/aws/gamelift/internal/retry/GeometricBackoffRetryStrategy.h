@@ -24,6 +24,8 @@ public:
 
     void apply(const std::function<bool(void)> &callable) override;
 
+    int GetRetryDelayMillis(int failedAttempts) override;
+
 private:
     static constexpr const int DEFAULT_MAX_RETRIES = 7;
     static constexpr const int DEFAULT_INITIAL_RETRY_INTERVAL_SECONDS = 4;
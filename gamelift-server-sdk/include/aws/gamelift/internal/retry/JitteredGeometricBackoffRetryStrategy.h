@@ -12,6 +12,7 @@
 
 #pragma once
 #include <aws/gamelift/internal/retry/RetryStrategy.h>
+#include <random>
 
 namespace Aws {
 namespace GameLift {
@@ -20,10 +21,12 @@ class JitteredGeometricBackoffRetryStrategy : public RetryStrategy {
 public:
     JitteredGeometricBackoffRetryStrategy()
         : m_maxRetries(DEFAULT_MAX_RETRIES), m_initialRetryIntervalMs(DEFAULT_INITIAL_RETRY_INTERVAL_MS), m_retryFactor(DEFAULT_RETRY_FACTOR),
-          m_minRetryDelayMs(DEFAULT_MIN_RETRY_DELAY_MS) {}
+          m_minRetryDelayMs(DEFAULT_MIN_RETRY_DELAY_MS), m_randGenerator(std::random_device()()) {}
 
     void apply(const std::function<bool(void)> &callable) override;
 
+    int GetRetryDelayMillis(int failedAttempts) override;
+
 private:
     static constexpr const int DEFAULT_MAX_RETRIES = 5;
     static constexpr const int DEFAULT_INITIAL_RETRY_INTERVAL_MS = 1000;
@@ -34,6 +37,7 @@ private:
     int m_initialRetryIntervalMs;
     int m_retryFactor;
     int m_minRetryDelayMs;
+    std::mt19937 m_randGenerator;
 };
 } // namespace Internal
 } // namespace GameLift
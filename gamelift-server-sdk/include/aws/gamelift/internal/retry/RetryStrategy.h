@@ -19,6 +19,10 @@ namespace Internal {
 class RetryStrategy {
 public:
     virtual void apply(const std::function<bool(void)> &callable) = 0;
+
+    // Returns the delay to wait after the given number of failed attempts, or a negative value once
+    // all attempts are used up. Lets callers back off on a timer instead of sleeping in apply().
+    virtual int GetRetryDelayMillis(int failedAttempts) = 0;
 };
 } // namespace Internal
 } // namespace GameLift
@@ -11,6 +11,8 @@
  */
 #pragma once
 
+#include <aws/gamelift/server/model/LoggerParameters.h>
+#include <spdlog/common.h>
 #include <string>
 
 namespace Aws {
@@ -18,13 +20,29 @@ namespace GameLift {
 namespace Internal {
 
 class LoggerHelper {
+public:
+    // Longest part of a message payload that is written to the log.
+    static constexpr size_t MAX_LOGGED_PAYLOAD_LENGTH = 1024;
+
+    // Returns a view of the start of the payload, so logging it copies and formats at most
+    // MAX_LOGGED_PAYLOAD_LENGTH characters, and nothing at all when the log level is disabled.
+    static spdlog::string_view_t TruncatePayload(const std::string& payload) {
+        return spdlog::string_view_t(payload.data(), payload.size() < MAX_LOGGED_PAYLOAD_LENGTH ? payload.size() : MAX_LOGGED_PAYLOAD_LENGTH);
+    }
+
 #ifdef GAMELIFT_USE_STD
 public:
-    static void InitializeLogger(const std::string& process_Id);
+    static void InitializeLogger(const std::string& process_Id,
+                                 const Aws::GameLift::Server::Model::LoggerParameters& loggerParameters = Aws::GameLift::Server::Model::LoggerParameters());
 #else
 public:
-    static void InitializeLogger(const char* process_Id);
+    static void InitializeLogger(const char* process_Id,
+                                 const Aws::GameLift::Server::Model::LoggerParameters& loggerParameters = Aws::GameLift::Server::Model::LoggerParameters());
 #endif
+
+    // Writes out everything logged so far. An asynchronous logger is replaced by a synchronous one on the
+    // same sinks and its queue is drained, so no lines are lost when the process exits after Destroy().
+    static void FlushLogger();
 };
 
 } // namespace Internal
@@ -0,0 +1,63 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Compact 128-bit id for correlating websocket requests with their responses. The upper half is a
+ * random value drawn once per thread and the lower half is a per-thread counter, so ids are unique
+ * without any shared state, streams or heap allocation. On the wire an id is 32 lowercase hex
+ * characters.
+ */
+class RequestId {
+public:
+    static constexpr const size_t TEXT_LENGTH = 32;
+
+    RequestId() : m_high(0), m_low(0) {}
+    RequestId(uint64_t high, uint64_t low) : m_high(high), m_low(low) {}
+
+    static RequestId Generate();
+
+    // Parses the textual form produced by ToString(). Returns false, leaving requestId untouched, if
+    // the text is not exactly TEXT_LENGTH hex characters.
+    static bool Parse(const char *text, size_t length, RequestId &requestId);
+    static bool Parse(const std::string &text, RequestId &requestId) { return Parse(text.data(), text.size(), requestId); }
+
+    // Writes the TEXT_LENGTH characters of the textual form into buffer. Does not null-terminate.
+    void ToChars(char *buffer) const;
+    std::string ToString() const;
+
+    inline bool operator==(const RequestId &other) const { return m_high == other.m_high && m_low == other.m_low; }
+    inline bool operator!=(const RequestId &other) const { return !(*this == other); }
+
+    struct Hash {
+        inline size_t operator()(const RequestId &requestId) const {
+            // The halves are already well distributed, one multiply mixes them without touching the text.
+            return static_cast<size_t>(requestId.m_high ^ (requestId.m_low * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+private:
+    uint64_t m_high;
+    uint64_t m_low;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,58 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Runs tasks on a single SDK-owned worker thread, either as soon as possible or after a delay.
+ * Delays are asio steady_timers on the worker's io_service, so any number of requests can back off
+ * at once without a thread sleeping for each of them. Tasks run one at a time, so they should not
+ * block for long.
+ */
+class TaskScheduler {
+public:
+    TaskScheduler();
+
+    ~TaskScheduler();
+
+    // Runs the task on the worker thread as soon as it is free.
+    void Post(const std::function<void()> &task);
+
+    // Runs the task on the worker thread once delayMillis have elapsed.
+    void PostAfter(int delayMillis, const std::function<void()> &task);
+
+    // Stops the worker thread. Tasks that have not started yet are dropped, and tasks posted after
+    // this call are ignored.
+    void Shutdown();
+
+private:
+    // Shared with the worker thread, so a worker that had to be detached during Shutdown() can
+    // still finish safely after the scheduler itself is gone. Defined in the .cpp to keep asio out
+    // of this header.
+    struct SharedState;
+
+    static void RunTask(const std::function<void()> &task);
+
+    std::shared_ptr<SharedState> m_state;
+    std::unique_ptr<std::thread> m_workerThread;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,67 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Fixed set of long-lived worker threads that run posted tasks in FIFO order. Used to run developer
+ * callbacks without creating a thread per event.
+ *
+ * The workers are detached: Shutdown() never waits for a task that is still running, so a callback
+ * that blocks (or that calls Destroy() itself) can't hold up SDK shutdown.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(int threadCount);
+
+    ~ThreadPool();
+
+    // taskName identifies the task in the log if it is dropped by Shutdown().
+    void Post(const std::function<void()> &task, const char *taskName);
+
+    // Drops tasks that have not started yet, logging each of them, and lets the workers exit once their
+    // current task is done. Tasks posted after this call are ignored.
+    void Shutdown();
+
+private:
+    struct Task {
+        std::function<void()> run;
+        const char *name;
+    };
+
+    // Shared with the workers, which may outlive the pool.
+    struct SharedState {
+        SharedState() : shutdown(false) {}
+
+        std::mutex lock;
+        std::condition_variable cond;
+        std::deque<Task> tasks;
+        bool shutdown;
+    };
+
+    static void Run(const std::shared_ptr<SharedState> &state);
+
+    std::shared_ptr<SharedState> m_state;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
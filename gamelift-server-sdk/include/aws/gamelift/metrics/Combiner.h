@@ -16,46 +16,55 @@
 #include <aws/gamelift/metrics/InternalTypes.h>
 
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
 
 using namespace ::Aws::GameLift::Metrics;
 
 /**
  * Combines metrics logged in the current capture period.
+ *
+ * State is kept in flat arrays indexed by metric id, so combining a message
+ * is an array access and clearing only touches the metrics that were combined.
  */
 class Combiner final {
-public:
-  using CombinedMessagesMap =
-      std::unordered_map<const IMetric *, MetricMessage>;
-
 public:
   void Add(MetricMessage message);
   void Clear();
 
   bool IsEmpty() const { return GetSize() == 0; }
-  std::size_t GetSize() const { return m_combinedMessages.size(); }
+  std::size_t GetSize() const { return m_combinedIds.size(); }
 
 private:
-  void UpdateGauge(const MetricMessage &newMessage);
+  struct MetricState {
+    MetricMessage Combined;
+    bool IsCombined = false;
+    int TimerSampleCount = 0;
+
+    /**
+     * We keep track of gauge values during the lifetime of the program.
+     * This allows us to detect whether a gauge has changed since the last
+     * collection update. If it has, we can submit it to combined messages to
+     * be emitted in the next statsd packet.
+     *
+     * This allows us to use the 'set gauge' syntax: foo:10|g. This allows us
+     * to support sending gauges to StatsD receivers that do not have
+     * long-term internal state, such as the OpenTelemetry collector.
+     */
+    bool HasGaugeHistory = false;
+    double GaugeHistory = 0;
+  };
+
+  MetricState &GetState(const IMetric &metric);
+  void SetCombined(MetricState &state, const MetricMessage &message);
+
+  void UpdateGauge(MetricState &state, const MetricMessage &newMessage);
   void UpdateCounter(MetricMessage &existing, const MetricMessage &newMessage);
-  void UpdateTimer(MetricMessage &existing, const MetricMessage &newMessage);
+  void UpdateTimer(MetricState &state, const MetricMessage &newMessage);
 
 private:
-  CombinedMessagesMap m_combinedMessages;
-  std::unordered_map<const IMetric *, int> m_timerSampleCount;
-
-  /**
-   * We keep track of gauge values during the lifetime of the program.
-   * This allows us to detect whether a gauge has changed since the last
-   * collection update. If it has, we can submit it to combined messages to be
-   * emitted in the next statsd packet.
-   *
-   * This allows us to use the 'set gauge' syntax: foo:10|g. This allows us to
-   * support sending gauges to StatsD receivers that do not have long-term
-   * internal state, such as the OpenTelemetry collector.
-   */
-  CombinedMessagesMap m_gaugeHistory;
+  std::vector<MetricState> m_metrics;
+  // Ids of the metrics combined this period, in the order first seen.
+  std::vector<MetricId> m_combinedIds;
 
   /**
    * STL iterator support.
@@ -69,9 +78,9 @@ public:
    *
    * @param ValueT The value type we return. Used to customize for const and
    * mutable iteration.
-   * @param BaseIterator The iterator of the underlying deduped message map.
+   * @param StateVector The metric state array, const for const iteration.
    */
-  template <class ValueT, class BaseIterator> class Iterator final {
+  template <class ValueT, class StateVector> class Iterator final {
     /**
      * STL type defs.
      */
@@ -83,13 +92,12 @@ public:
     using reference = value_type &;
 
   public:
-    Iterator(BaseIterator base) : m_base(base) {}
-
-    reference operator*() { return m_base->second; }
-    pointer operator->() { return &m_base->second; }
+    Iterator(StateVector &metrics,
+             std::vector<MetricId>::const_iterator base)
+        : m_metrics(&metrics), m_base(base) {}
 
-    reference operator*() const { return m_base->second; }
-    pointer operator->() const { return &m_base->second; }
+    reference operator*() const { return (*m_metrics)[*m_base].Combined; }
+    pointer operator->() const { return &(*m_metrics)[*m_base].Combined; }
 
     // Pre-increment
     Iterator &operator++() {
@@ -111,27 +119,28 @@ public:
     };
 
   private:
-    BaseIterator m_base;
+    StateVector *m_metrics;
+    std::vector<MetricId>::const_iterator m_base;
   };
 
   using value_type = MetricMessage;
-  using iterator = Iterator<value_type, CombinedMessagesMap::iterator>;
+  using iterator = Iterator<value_type, std::vector<MetricState>>;
   using const_iterator =
-      Iterator<const value_type, CombinedMessagesMap::const_iterator>;
+      Iterator<const value_type, const std::vector<MetricState>>;
 
-  iterator begin() { return iterator(std::begin(m_combinedMessages)); }
-  iterator end() { return iterator(std::end(m_combinedMessages)); }
+  iterator begin() { return iterator(m_metrics, m_combinedIds.cbegin()); }
+  iterator end() { return iterator(m_metrics, m_combinedIds.cend()); }
 
   const_iterator begin() const { return cbegin(); }
   const_iterator end() const { return cend(); }
 
   const_iterator cbegin() const {
-    return const_iterator(m_combinedMessages.begin());
+    return const_iterator(m_metrics, m_combinedIds.cbegin());
   }
   const_iterator cend() const {
-    return const_iterator(m_combinedMessages.end());
+    return const_iterator(m_metrics, m_combinedIds.cend());
   }
 
   std::size_t size() const { return GetSize(); }
   bool empty() const { return IsEmpty(); }
-};
\ No newline at end of file
+};
@@ -33,6 +33,8 @@
     using SamplerType = decltype(sampler_expr);                                \
     using DerivedMetricCollectionType =                                        \
         decltype(Aws::GameLift::Metrics::CollectDerivedMetrics(__VA_ARGS__));  \
+    static constexpr int DerivedMetricCount =                                  \
+        DerivedMetricCollectionType::Size;                                     \
                                                                                \
     static name &Instance();                                                   \
                                                                                \
@@ -56,7 +58,8 @@
     DerivedMetricCollectionType DerivedMetrics;                                \
                                                                                \
     name()                                                                     \
-        : Key(key), Sampler(sampler_expr),                                     \
+        : ::Aws::GameLift::Metrics::IMetric(DerivedMetricCount > 0),           \
+          Key(key), Sampler(sampler_expr),                                     \
           DerivedMetrics(                                                      \
               Aws::GameLift::Metrics::CollectDerivedMetrics(__VA_ARGS__)) {}   \
   }
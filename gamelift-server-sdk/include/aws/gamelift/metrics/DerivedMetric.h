@@ -81,6 +81,8 @@ template <class... DerivedMetric> struct DerivedMetricCollection;
  * No-op visitor.
  */
 template <> struct DerivedMetricCollection<> : public IDerivedMetricCollection {
+  static constexpr int Size = 0;
+
   DerivedMetricCollection() = default;
 
   virtual void Visit(IDerivedMetricVisitor &visitor) override {
@@ -96,6 +98,8 @@ struct DerivedMetricCollection<First, Rest...>
     : public DerivedMetricCollection<Rest...> {
   using Base = DerivedMetricCollection<Rest...>;
 
+  static constexpr int Size = 1 + Base::Size;
+
   DerivedMetricCollection(First &&firstMetric, Rest &&...otherMetrics)
       : Base(Internal::Forward<Rest>(otherMetrics)...),
         m_metric(Internal::Forward<First>(firstMetric)) {}
@@ -114,6 +118,8 @@ private:
  */
 template <class Single>
 struct DerivedMetricCollection<Single> : public IDerivedMetricCollection {
+  static constexpr int Size = 1;
+
   DerivedMetricCollection(Single &&singleMetric)
       : m_metric(Internal::Forward<Single>(singleMetric)) {}
 
@@ -25,6 +25,8 @@ namespace Metrics {
 
 class DynamicMetric : public IMetric {
 public:
+  DynamicMetric() : IMetric(false) {}
+
   virtual const char *GetKey() const override { return m_key.c_str(); }
   virtual MetricType GetMetricType() const override { return m_type; }
   virtual IDerivedMetricCollection &GetDerivedMetrics() override {
@@ -89,7 +91,7 @@ class GAMELIFT_METRICS_API DynamicMetric : public IMetric {
 public:
   static constexpr int MAXIMUM_KEY_LENGTH = 1024;
 
-  DynamicMetric() = default;
+  DynamicMetric() : IMetric(false) {}
   DynamicMetric(const DynamicMetric &) = default;
 
   virtual const char *GetKey() const override { return m_key; }
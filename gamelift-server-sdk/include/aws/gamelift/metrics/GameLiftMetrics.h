@@ -16,15 +16,18 @@
 #include <aws/gamelift/metrics/DefinitionMacros.h>
 #include <aws/gamelift/metrics/GaugeMacros.h>
 #include <aws/gamelift/metrics/GlobalMetricsProcessor.h>
+#include <aws/gamelift/metrics/Histogram.h>
 #include <aws/gamelift/metrics/IMetricsProcessor.h>
 #include <aws/gamelift/metrics/InternalTypes.h>
 #include <aws/gamelift/metrics/Latest.h>
 #include <aws/gamelift/metrics/LoggerMacros.h>
 #include <aws/gamelift/metrics/Mean.h>
+#include <aws/gamelift/metrics/MetricFamily.h>
 #include <aws/gamelift/metrics/Percentiles.h>
 #include <aws/gamelift/metrics/Platform.h>
 #include <aws/gamelift/metrics/ReduceMetric.h>
 #include <aws/gamelift/metrics/Samplers.h>
 #include <aws/gamelift/metrics/ScopedTimer.h>
+#include <aws/gamelift/metrics/Summary.h>
 #include <aws/gamelift/metrics/TagMacros.h>
 #include <aws/gamelift/metrics/TimerMacros.h>
@@ -0,0 +1,101 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/metrics/DerivedMetric.h>
+#include <aws/gamelift/metrics/DynamicMetric.h>
+#include <aws/gamelift/metrics/UniquePtr.h>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Metrics {
+namespace Internal {
+class GAMELIFT_METRICS_API HistogramWrapper : public IDerivedMetric {
+public:
+  static HistogramWrapper Create(double *boundsItBegin, double *boundsItEnd);
+
+  virtual void HandleMessage(MetricMessage &message,
+                             IMetricsEnqueuer &submitter) override {
+    m_impl->HandleMessage(message, submitter);
+  }
+
+  virtual void EmitMetrics(const IMetric *originalMetric,
+                           IMetricsEnqueuer &submitter) override {
+    m_impl->EmitMetrics(originalMetric, submitter);
+  }
+
+private:
+  explicit HistogramWrapper(IDerivedMetric *impl) : m_impl(impl) {}
+
+private:
+  UniquePtr<IDerivedMetric> m_impl;
+};
+} // namespace Internal
+
+/**
+ * Count values into buckets with the given upper bounds.
+ *
+ * Each capture period, every bucket is emitted as a `.bucket` counter tagged
+ * with its inclusive upper bound, `le:<bound>`, counting values less than or
+ * equal to that bound. A final `le:+Inf` bucket counts every value. The sum of
+ * all values is emitted as a `.sum` counter.
+ *
+ * Unlike percentiles, counters from many processes can be summed, so the
+ * buckets give fleet-wide distributions and percentiles.
+ */
+template <class... Real>
+inline Internal::HistogramWrapper Histogram(Real... bounds) {
+  std::vector<double> boundsVec = {static_cast<double>(bounds)...};
+  double *boundsBegin = boundsVec.data();
+  double *boundsEnd = boundsBegin + boundsVec.size();
+  return Internal::HistogramWrapper::Create(boundsBegin, boundsEnd);
+}
+
+/**
+ * Histogram with bucketCount bounds starting at start and each one factor
+ * times the previous, e.g. ExponentialHistogram(1, 2, 4) has bounds 1, 2, 4
+ * and 8.
+ */
+inline Internal::HistogramWrapper
+ExponentialHistogram(double start, double factor, int bucketCount) {
+  std::vector<double> boundsVec;
+  double bound = start;
+  for (int i = 0; i < bucketCount; ++i) {
+    boundsVec.emplace_back(bound);
+    bound *= factor;
+  }
+  double *boundsBegin = boundsVec.data();
+  double *boundsEnd = boundsBegin + boundsVec.size();
+  return Internal::HistogramWrapper::Create(boundsBegin, boundsEnd);
+}
+
+/**
+ * Histogram with bucketCount bounds starting at start and each one width
+ * above the previous, e.g. LinearHistogram(10, 10, 3) has bounds 10, 20 and
+ * 30.
+ */
+inline Internal::HistogramWrapper LinearHistogram(double start, double width,
+                                                  int bucketCount) {
+  std::vector<double> boundsVec;
+  for (int i = 0; i < bucketCount; ++i) {
+    boundsVec.emplace_back(start + i * width);
+  }
+  double *boundsBegin = boundsVec.data();
+  double *boundsEnd = boundsBegin + boundsVec.size();
+  return Internal::HistogramWrapper::Create(boundsBegin, boundsEnd);
+}
+
+} // namespace Metrics
+} // namespace GameLift
+} // namespace Aws
@@ -320,8 +320,18 @@ extern GAMELIFT_METRICS_API void CopyTagMessage(const MetricMessage &original,
  */
 class GAMELIFT_METRICS_API IMetricsProcessor : public IMetricsEnqueuer {
 public:
+  IMetricsProcessor();
   virtual ~IMetricsProcessor();
 
+  /**
+   * @brief Gets an id that no other processor in this process has had.
+   *
+   * Unlike the processor's address, the id tells apart a processor from one
+   * that was destroyed before it, e.g. across MetricsTerminate and
+   * MetricsInitialize.
+   */
+  uint64_t GetProcessorId() const { return m_processorId; }
+
 #ifdef GAMELIFT_USE_STD
   /**
    * Sets a key:value tag to be applied to all metrics.
@@ -377,6 +387,9 @@ public:
    */
   virtual void OnStartGameSession(
       const Aws::GameLift::Server::Model::GameSession &session) = 0;
+
+private:
+  uint64_t m_processorId;
 };
 
 } // namespace Metrics
@@ -27,6 +27,12 @@ namespace Metrics {
 using UInt8 = uint8_t;
 using Int64 = int64_t;
 
+/**
+ * INTERNAL: Dense id of a metric instance, assigned in creation order starting
+ * from 0. Used to index per-metric state. Ids are not reused.
+ */
+using MetricId = uint32_t;
+
 struct MetricMessage;
 class IMetricsProcessor;
 struct ISampler;
@@ -60,12 +66,35 @@ template <> inline MetricType GetMetricType<Timer>() {
  * INTERNAL: Interface for all user-defined metrics.
  */
 struct GAMELIFT_METRICS_API IMetric {
+  IMetric();
+  /**
+   * @param hasDerivedMetrics False if GetDerivedMetrics() is always empty, so
+   * the processor can skip visiting it.
+   */
+  explicit IMetric(bool hasDerivedMetrics);
+  // A copy is a distinct metric, so it gets its own id.
+  IMetric(const IMetric &);
+  IMetric &operator=(const IMetric &) { return *this; }
   virtual ~IMetric();
 
   virtual MetricType GetMetricType() const = 0;
   virtual const char *GetKey() const = 0;
   virtual IDerivedMetricCollection &GetDerivedMetrics() = 0;
   virtual ISampler &GetSampler() = 0;
+
+  MetricId GetId() const noexcept { return m_id; }
+
+  /**
+   * @brief Whether the processor has to visit the derived metrics.
+   *
+   * Known at compile time for metrics declared with the metric macros. Other
+   * metrics report true unless they were constructed otherwise.
+   */
+  bool HasDerivedMetrics() const noexcept { return m_hasDerivedMetrics; }
+
+private:
+  MetricId m_id;
+  bool m_hasDerivedMetrics;
 };
 
 /**
@@ -18,21 +18,21 @@
 #include <cstdlib>
 
 #define GAMELIFT_METRICS_LOG_INFO(format, ...)                                 \
-  spdlog::info("[METRICS] " format, ##__VA_ARGS__)
+  SPDLOG_INFO("[METRICS] " format, ##__VA_ARGS__)
 
 #define GAMELIFT_METRICS_LOG_WARN(format, ...)                                 \
-  spdlog::warn("[METRICS] " format, ##__VA_ARGS__)
+  SPDLOG_WARN("[METRICS] " format, ##__VA_ARGS__)
 
 #define GAMELIFT_METRICS_LOG_ERROR(format, ...)                                \
-  spdlog::error("[METRICS] " format, ##__VA_ARGS__)
+  SPDLOG_ERROR("[METRICS] " format, ##__VA_ARGS__)
 
 #if defined(GAMELIFT_METRICS_DEBUG) && GAMELIFT_METRICS_DEBUG
 #define GAMELIFT_METRICS_LOG_CRITICAL(format, ...)                             \
   do {                                                                         \
-    spdlog::critical("[METRICS] " format, ##__VA_ARGS__);                      \
+    SPDLOG_CRITICAL("[METRICS] " format, ##__VA_ARGS__);                       \
     std::abort();                                                              \
   } while (0)
 #else
 #define GAMELIFT_METRICS_LOG_CRITICAL(format, ...)                             \
-  spdlog::critical("[METRICS] " format, ##__VA_ARGS__)
+  SPDLOG_CRITICAL("[METRICS] " format, ##__VA_ARGS__)
 #endif
@@ -0,0 +1,272 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/metrics/Defs.h>
+#include <aws/gamelift/metrics/DerivedMetric.h>
+#include <aws/gamelift/metrics/GlobalMetricsProcessor.h>
+#include <aws/gamelift/metrics/IMetricsProcessor.h>
+#include <aws/gamelift/metrics/InternalTypes.h>
+#include <aws/gamelift/metrics/LoggerMacros.h>
+#include <aws/gamelift/metrics/TypeTraits.h>
+#include <aws/gamelift/metrics/UniquePtr.h>
+
+#include <atomic>
+#include <stddef.h>
+
+#ifdef GAMELIFT_USE_STD
+#include <string>
+#endif
+
+namespace Aws {
+namespace GameLift {
+namespace Metrics {
+
+/**
+ * @brief A metric family's metric for one set of label values.
+ *
+ * Has the key, type and sampler of the family's metric, and is logged with its
+ * labels as per-metric tags. Has no derived metrics.
+ */
+class GAMELIFT_METRICS_API LabeledMetric : public IMetric {
+public:
+  /**
+   * @param parent The family's metric.
+   * @param labels labelCount label keys and values, laid out as key, value,
+   * key, value... Must outlive this metric.
+   * @param labelCount Number of labels.
+   */
+  LabeledMetric(IMetric &parent, const char *const *labels, int labelCount)
+      : IMetric(false), m_parent(parent), m_labels(labels),
+        m_labelCount(labelCount), m_taggedProcessorId(0) {}
+
+  LabeledMetric(const LabeledMetric &) = delete;
+  LabeledMetric &operator=(const LabeledMetric &) = delete;
+
+  virtual const char *GetKey() const override { return m_parent.GetKey(); }
+  virtual MetricType GetMetricType() const override {
+    return m_parent.GetMetricType();
+  }
+  virtual IDerivedMetricCollection &GetDerivedMetrics() override {
+    static DerivedMetricCollection<> Collection;
+    return Collection;
+  }
+  virtual ISampler &GetSampler() override { return m_parent.GetSampler(); }
+
+  int GetLabelCount() const { return m_labelCount; }
+  const char *GetLabelKey(int index) const { return m_labels[index * 2]; }
+  const char *GetLabelValue(int index) const { return m_labels[index * 2 + 1]; }
+
+  /**
+   * @brief Enqueues message to processor.
+   *
+   * The first time this metric is submitted to a processor, its labels are
+   * enqueued as tags ahead of the message. The processor keeps them from then
+   * on, so later messages cost the same as those of any other metric.
+   */
+  void Submit(IMetricsProcessor &processor, MetricMessage message);
+
+private:
+  IMetric &m_parent;
+  const char *const *m_labels;
+  int m_labelCount;
+  // Id of the processor the labels were last enqueued to. Ids rather than
+  // addresses, since a new processor may be allocated where an old one was.
+  std::atomic<uint64_t> m_taggedProcessorId;
+};
+
+namespace Internal {
+class MetricFamilyImpl;
+
+/**
+ * INTERNAL: interns label strings and owns the children of a MetricFamily.
+ */
+class GAMELIFT_METRICS_API MetricFamilyBase {
+public:
+  explicit MetricFamilyBase(IMetric &parent);
+  ~MetricFamilyBase();
+
+  MetricFamilyBase(const MetricFamilyBase &) = delete;
+  MetricFamilyBase &operator=(const MetricFamilyBase &) = delete;
+
+  /**
+   * @brief Gets the child metric for a set of labels, creating it the first
+   * time the set is seen.
+   *
+   * Labels may be given in any order. Each label string is copied the first
+   * time it is seen, after which finding the child allocates nothing.
+   *
+   * @param labels labelCount label keys and values, laid out as key, value,
+   * key, value...
+   * @param labelCount Number of labels.
+   */
+  LabeledMetric &WithLabelArray(const char *const *labels, int labelCount);
+
+  /**
+   * @return Number of label sets this family has seen.
+   */
+  size_t GetChildCount() const;
+
+private:
+  UniquePtr<MetricFamilyImpl> m_impl;
+};
+
+inline const char *LabelCString(const char *label) { return label; }
+#ifdef GAMELIFT_USE_STD
+inline const char *LabelCString(const std::string &label) {
+  return label.c_str();
+}
+#endif
+} // namespace Internal
+
+/**
+ * @brief A metric broken down by runtime labels, e.g. players per map and
+ * mode.
+ *
+ * Each distinct set of labels gets its own child metric, kept for the life of
+ * the family. Label strings are interned once, so looking up a known child
+ * allocates nothing, and updating a child costs the same as updating Metric.
+ * Keep the child around to skip the lookup as well.
+ *
+ * @code
+ * GAMELIFT_METRICS_DECLARE_GAUGE(MetricPlayers, "players", MyPlatform,
+ *                                Aws::GameLift::Metrics::SampleAll());
+ * GAMELIFT_METRICS_DEFINE_GAUGE(MetricPlayers);
+ *
+ * Aws::GameLift::Metrics::MetricFamily<MetricPlayers> PlayersPerMap;
+ * PlayersPerMap.WithLabels("map", mapName, "mode", modeName).Set(players);
+ * @endcode
+ *
+ * Children share Metric's key, platform and sampler, and do not have Metric's
+ * derived metrics.
+ *
+ * @tparam Metric Metric declared with one of the GAMELIFT_METRICS_DECLARE
+ * macros.
+ */
+template <class Metric> class MetricFamily : public Internal::MetricFamilyBase {
+public:
+  /**
+   * @brief Handle to a child metric. Cheap to copy and valid for the life of
+   * the family.
+   */
+  class Child {
+  public:
+    explicit Child(LabeledMetric &metric) : m_metric(&metric) {}
+
+    LabeledMetric &GetMetric() const { return *m_metric; }
+
+    /**
+     * @brief Sets a gauge to a value.
+     */
+    void Set(double value) const {
+      static_assert(IsSupported<typename Metric::MetricType, Gauge>::value,
+                    "Child::Set only supports gauges.");
+      Submit(MetricMessage::GaugeSet(*m_metric, value), true);
+    }
+
+    /**
+     * @brief Resets a gauge back to zero. Not sampled.
+     */
+    void Reset() const {
+      static_assert(IsSupported<typename Metric::MetricType, Gauge>::value,
+                    "Child::Reset only supports gauges.");
+      Submit(MetricMessage::GaugeSet(*m_metric, 0), false);
+    }
+
+    /**
+     * @brief Adds a value to a gauge or a counter.
+     */
+    void Add(double value) const {
+      static_assert(
+          IsSupported<typename Metric::MetricType, Gauge, Counter>::value,
+          "Child::Add only supports gauges and counters.");
+      IF_CONSTEXPR(
+          Internal::IsSame<typename Metric::MetricType, Gauge>::value) {
+        Submit(MetricMessage::GaugeAdd(*m_metric, value), true);
+      }
+      else {
+        Submit(MetricMessage::CounterAdd(*m_metric, value), true);
+      }
+    }
+
+    /**
+     * @brief Subtracts a value from a gauge.
+     */
+    void Subtract(double value) const {
+      static_assert(IsSupported<typename Metric::MetricType, Gauge>::value,
+                    "Child::Subtract only supports gauges.");
+      Add(-value);
+    }
+
+    /**
+     * @brief Adds one to a gauge or a counter.
+     */
+    void Increment() const { Add(1); }
+
+    /**
+     * @brief Subtracts one from a gauge.
+     */
+    void Decrement() const { Subtract(1); }
+
+    /**
+     * @brief Sets a timer to a value in milliseconds.
+     */
+    void SetMilliseconds(double value) const {
+      static_assert(IsSupported<typename Metric::MetricType, Timer>::value,
+                    "Child::SetMilliseconds only supports timers.");
+      Submit(MetricMessage::TimerSet(*m_metric, value), true);
+    }
+
+    /**
+     * @brief Sets a timer to a value in seconds.
+     */
+    void SetSeconds(double value) const { SetMilliseconds(value * 1000.0); }
+
+  private:
+    void Submit(const MetricMessage &message, bool isSampled) const {
+      IF_CONSTEXPR(Metric::Platform::bEnabled) {
+        if (!isSampled || m_metric->GetSampler().ShouldTakeSample()) {
+          auto *Processor = GameLiftMetricsGlobalProcessor();
+          if (Processor) {
+            m_metric->Submit(*Processor, message);
+          } else {
+            GAMELIFT_METRICS_LOG_CRITICAL(
+                "Global metrics processor is not initialized");
+          }
+        }
+      }
+    }
+
+    LabeledMetric *m_metric;
+  };
+
+  MetricFamily() : Internal::MetricFamilyBase(Metric::Instance()) {}
+
+  /**
+   * @brief Gets the child metric for a set of labels.
+   *
+   * @param labels Label keys and values in pairs: key, value, key, value...
+   * Each one is a C string or, with GAMELIFT_USE_STD, a std::string.
+   */
+  template <class... Labels> Child WithLabels(const Labels &...labels) {
+    static_assert(sizeof...(Labels) > 0 && sizeof...(Labels) % 2 == 0,
+                  "WithLabels takes label keys and values in pairs.");
+    const char *labelArray[] = {Internal::LabelCString(labels)...};
+    return Child(WithLabelArray(labelArray,
+                                static_cast<int>(sizeof...(Labels) / 2)));
+  }
+};
+
+} // namespace Metrics
+} // namespace GameLift
+} // namespace Aws
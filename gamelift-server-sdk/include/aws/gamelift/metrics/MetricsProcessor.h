@@ -19,9 +19,15 @@
 #include "Combiner.h"
 #include "PacketBuilder.h"
 #include "Tags.h"
+#include "ThreadAggregator.h"
+#include <atomic>
 #include <chrono>
 #include <concurrentqueue.h>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class MetricsProcessor : public IMetricsProcessor {
@@ -37,38 +43,63 @@ public:
    * metrics processor
    */
   explicit MetricsProcessor(
-      const Aws::GameLift::Metrics::MetricsSettings &settings)
-      : m_sendPacket(settings.SendPacketCallback),
-        m_captureInterval(std::chrono::duration_cast<NativeDurationT>(
-            SecondsT(settings.CaptureIntervalSec))),
-        m_nextCaptureTime(ClockT::now() + m_captureInterval),
-        m_packet(settings.MaxPacketSizeBytes, settings.FloatPrecision) {}
-
-  virtual void Enqueue(MetricMessage message) override {
-    m_messageQueueMPSC.enqueue(message);
+      const Aws::GameLift::Metrics::MetricsSettings &settings);
+
+  /**
+   * Stops the background flush thread, if any. Metrics still queued are not
+   * processed.
+   */
+  virtual ~MetricsProcessor() { StopBackgroundFlush(); }
+
+  virtual void Enqueue(MetricMessage message) override;
+
+  /**
+   * @brief Gets the number of messages dropped because the queue was full.
+   * @return Messages dropped since the processor was created
+   */
+  uint64_t GetDroppedMessageCount() const {
+    return m_droppedMessageCount.load(std::memory_order_relaxed);
   }
 
 #ifdef GAMELIFT_USE_STD
   virtual void SetGlobalTag(const std::string &key,
                             const std::string &value) override {
-    m_globalTags[key] = value;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto inserted = m_globalTags.emplace(key, value);
+    if (inserted.second) {
+      m_globalTagsChanged = true;
+    } else if (inserted.first->second != value) {
+      inserted.first->second = value;
+      m_globalTagsChanged = true;
+    }
   }
 
   virtual void RemoveGlobalTag(const std::string &key) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_globalTags.find(key);
     if (it != std::end(m_globalTags)) {
       m_globalTags.erase(it);
+      m_globalTagsChanged = true;
     }
   }
 #else
   virtual void SetGlobalTag(const char *key, const char *value) override {
-    m_globalTags[key] = value;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto inserted = m_globalTags.emplace(key, value);
+    if (inserted.second) {
+      m_globalTagsChanged = true;
+    } else if (inserted.first->second != value) {
+      inserted.first->second = value;
+      m_globalTagsChanged = true;
+    }
   }
 
   virtual void RemoveGlobalTag(const char *key) override {
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_globalTags.find(key);
     if (it != std::end(m_globalTags)) {
       m_globalTags.erase(it);
+      m_globalTagsChanged = true;
     }
   }
 #endif
@@ -133,9 +164,60 @@ public:
   virtual void
   OnStartGameSession(const Aws::GameLift::Server::Model::GameSession &session);
 
+  /**
+   * @brief Whether metrics are processed on a background flush thread.
+   * @return True if the processor owns a flush thread
+   */
+  bool IsBackgroundFlush() const { return m_flushThread.joinable(); }
+
+  /**
+   * @brief Stops the background flush thread, if any.
+   *
+   * Waits for a flush in progress to finish. Metrics are then only processed
+   * by calling ProcessMetrics or ProcessMetricsNow.
+   */
+  void StopBackgroundFlush();
+
 private:
   void ProcessMessages(std::vector<MetricMessage> &messages);
 
+  /**
+   * @brief Hands messages to their metric's derived metrics, and records the
+   * metrics to emit derived metrics for.
+   *
+   * Metrics without derived metrics are skipped without visiting them.
+   */
+  void UpdateDerivedMetrics(std::vector<MetricMessage> &messages);
+  void SubmitDerivedMetrics();
+
+  struct ProducerThreadState;
+
+  /**
+   * @brief Gets the calling thread's producer token and aggregator for this
+   * processor, claiming them on the thread's first message.
+   */
+  ProducerThreadState &GetProducerThreadState();
+
+  void DrainThreadAggregators(std::vector<MetricMessage> &messages);
+
+  void RunFlushThread(
+      Aws::GameLift::Metrics::MetricsSettings::FlushThreadStartFunc
+          flushThreadStart);
+
+  /**
+   * @brief Gets the rendered global and per-metric tags for a metric.
+   *
+   * Rendered once and cached until the metric's tags or the global tags
+   * change.
+   */
+  const std::string &GetTagSuffix(const IMetric *metric);
+  void ClearTagSuffixes();
+
+  /**
+   * @brief Copies the global tags for this capture if they have changed.
+   */
+  void UpdateCaptureGlobalTags();
+
   struct VectorEnqueuer : public IMetricsEnqueuer {
     std::vector<MetricMessage> m_messages;
 
@@ -148,10 +230,24 @@ private:
 
 private:
   moodycamel::ConcurrentQueue<MetricMessage> m_messageQueueMPSC;
+  // Claimed by enqueuing threads on first use. Declared after the queue so
+  // they are destroyed before it.
+  std::vector<moodycamel::ProducerToken> m_producerTokens;
+  std::atomic<size_t> m_claimedProducerTokens;
+  // 0 for no limit.
+  const int64_t m_maxQueuedMessages;
+  // Messages enqueued and not yet drained, counted only with a limit. The
+  // queue's own capacity is per producer, so the limit is enforced here.
+  std::atomic<int64_t> m_queuedMessageCount;
+  const bool m_threadLocalAggregation;
+  std::atomic<uint64_t> m_droppedMessageCount;
+  uint64_t m_reportedDroppedMessageCount = 0;
 
   Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc m_sendPacket;
   Aws::GameLift::Metrics::MetricsSettings::PreProcessingFunc
       m_preProcessCallback;
+  Aws::GameLift::Metrics::MetricsSettings::PostProcessingFunc
+      m_postProcessCallback;
 
   NativeDurationT m_captureInterval;
   TimeT m_nextCaptureTime;
@@ -160,7 +256,37 @@ private:
   Combiner m_combinedMetrics;
   PacketBuilder m_packet;
   Tags m_metricTags;
+  // Guarded by m_mutex. Captures render tags from m_captureGlobalTags.
   std::unordered_map<std::string, std::string> m_globalTags;
+  bool m_globalTagsChanged = false;
+  std::unordered_map<std::string, std::string> m_captureGlobalTags;
+  struct CachedTagSuffix {
+    bool IsRendered = false;
+    std::string Suffix;
+  };
+  // Indexed by metric id.
+  std::vector<CachedTagSuffix> m_tagSuffixes;
 
   VectorEnqueuer m_enqueuer;
+
+  // Metrics with derived metrics that received messages this capture period,
+  // in the order first seen. The flags are indexed by metric id.
+  std::vector<IMetric *> m_pendingDerivedMetrics;
+  std::vector<bool> m_isDerivedMetricPending;
+
+  // One per thread that has logged metrics. Shared with the thread, so values
+  // aggregated by a thread that has exited are still drained.
+  std::mutex m_threadAggregatorsMutex;
+  std::vector<std::shared_ptr<ThreadAggregator>> m_threadAggregators;
+
+  // Serializes captures. Held while SendPacketCallback and
+  // PostProcessingCallback run, so they must not capture metrics themselves.
+  std::mutex m_processMutex;
+
+  // Guards global tags and the flush thread's wakeup state. Never held while
+  // calling a callback, so callbacks may set global tags.
+  std::mutex m_mutex;
+  std::condition_variable m_flushThreadWakeup;
+  bool m_stopFlushThread = false;
+  std::thread m_flushThread;
 };
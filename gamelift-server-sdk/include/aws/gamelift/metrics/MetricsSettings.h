@@ -23,10 +23,14 @@ namespace Metrics {
 struct GAMELIFT_METRICS_API MetricsSettings {
   using SendPacketFunc = Function<void(const char *, int)>;
   using PreProcessingFunc = Function<void()>;
+  using PostProcessingFunc = Function<void()>;
+  using FlushThreadStartFunc = Function<void()>;
 
   /**
    * Callback used to send UDP packets.
    * Use this to integrate with engine native sockets.
+   * Called during a capture, so it must not call ProcessMetrics or
+   * ProcessMetricsNow.
    */
   SendPacketFunc SendPacketCallback;
 
@@ -35,6 +39,15 @@ struct GAMELIFT_METRICS_API MetricsSettings {
    */
   PreProcessingFunc PreProcessingCallback;
 
+  /**
+   * Callback after the packets for current collection period have been passed
+   * to SendPacketCallback.
+   * Use this to flush packets that SendPacketCallback batches.
+   * Called during a capture, so it must not call ProcessMetrics or
+   * ProcessMetricsNow.
+   */
+  PostProcessingFunc PostProcessingCallback;
+
   /**
    * Maximum packet size in bytes.
    *
@@ -57,6 +70,57 @@ struct GAMELIFT_METRICS_API MetricsSettings {
    */
   int FloatPrecision = 5;
 
+  /**
+   * Maximum number of metric messages queued between captures, or 0 for no
+   * limit.
+   *
+   * The limit is shared by all threads. Each of the MaxProducerThreads
+   * producer slots gets room for this many messages up front, so threads with
+   * a slot never allocate to enqueue; threads without one allocate as the
+   * queue grows. Once the limit is reached, further messages are dropped and
+   * counted until the next capture drains the queue. Tag messages are never
+   * dropped and may go over the limit.
+   */
+  int MaxQueuedMessages = 0;
+
+  /**
+   * Number of threads that get a preallocated producer slot in the metrics
+   * queue.
+   *
+   * A thread claims a slot on its first metric and keeps it. Threads beyond
+   * this number share a slower path that allocates once per thread.
+   */
+  int MaxProducerThreads = 16;
+
+  /**
+   * Pre-aggregate counters and gauges on the thread that logs them.
+   *
+   * Each thread sums its counters and keeps the latest value of its gauges,
+   * and only hands those to the processor at capture time, instead of queueing
+   * a message per update. Metrics with derived metrics are always queued.
+   *
+   * Gauges set from several threads in the same capture period end up with the
+   * value from one of them, not necessarily the last one set.
+   */
+  bool ThreadLocalAggregation = false;
+
+  /**
+   * Process metrics on a background thread owned by the SDK.
+   *
+   * When enabled, the SDK processes and sends metrics every CaptureInterval
+   * seconds on its own thread, and MetricsProcess() does nothing. Game threads
+   * only pay for queueing metric messages.
+   */
+  bool BackgroundFlush = false;
+
+  /**
+   * Called on the background flush thread before it processes any metrics.
+   *
+   * Use this to set the thread's CPU affinity, priority or name. If not set,
+   * the flush thread lowers its own scheduling priority instead.
+   */
+  FlushThreadStartFunc FlushThreadStartCallback;
+
    /**
     * Crash reporter host.
     */
@@ -15,12 +15,19 @@
 #include <aws/gamelift/metrics/IMetricsProcessor.h>
 #include <aws/gamelift/metrics/MetricsSettings.h>
 
-#include <sstream>
+#include <ostream>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 using namespace ::Aws::GameLift::Metrics;
 
+/**
+ * @brief Builds StatsD packets from metric messages.
+ *
+ * Messages are formatted straight into a buffer sized to the packet size,
+ * without streams or per-message allocations.
+ */
 class PacketBuilder final {
 public:
   using TagMap = std::unordered_map<std::string, std::string>;
@@ -45,6 +52,18 @@ public:
       const TagMap &metricTags,
       Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc);
 
+  /**
+   * @brief Appends message to the back of the packet.
+   *
+   * @param message Message to append.
+   * @param tagSuffix Tags already rendered by RenderTagSuffix.
+   * @param sendPacketFunc Callback called with the current packet data whenever
+   * the packet fills up.
+   */
+  void Append(
+      const MetricMessage &message, const std::string &tagSuffix,
+      Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc);
+
   /**
    * @brief Flushes the internal buffers via sendPacketFunc.
    * Resets internal state for new metrics.
@@ -64,7 +83,12 @@ public:
    * @brief Sets the maximum packet size in bytes.
    * @param packetSize The new maximum packet size in bytes
    */
-  void SetPacketSize(size_t packetSize) { m_packetSize = packetSize; }
+  void SetPacketSize(size_t packetSize) {
+    m_packetSize = packetSize;
+    if (m_packetBuffer.size() < packetSize) {
+      m_packetBuffer.resize(packetSize);
+    }
+  }
 
   /**
    * @brief Fluent setter for packet size
@@ -104,10 +128,23 @@ private:
   size_t m_packetSize;
   int m_floatPrecision = 5;
 
-  std::string m_sendBuffer;
-  std::stringstream m_formatBuffer;
+  // Holds the packet being built, plus room for the null terminator.
+  std::vector<char> m_packetBuffer;
+  size_t m_packetLength = 0;
 };
 
+/**
+ * @brief Renders tags as the dogstatsd suffix of a metric line, eg
+ * `|#key1:value1,key2:value2`.
+ *
+ * @param globalTags Global metric tags, rendered first.
+ * @param metricTags Per-metric tags.
+ *
+ * @return The tag suffix, or an empty string if there are no tags.
+ */
+extern std::string RenderTagSuffix(const PacketBuilder::TagMap &globalTags,
+                                   const PacketBuilder::TagMap &metricTags);
+
 /**
  * @brief Appends Message to Stream in dogstatsd format.
  *
@@ -120,7 +157,8 @@ private:
  * point numbers
  * @param globalTags Global metric tags
  * @param metricTags Per-metric tags.
- * @param stream An Output stream to append to.
+ * @param stream An Output stream to append to. Its formatting flags are not
+ * used.
  */
 extern void AppendToStream(const MetricMessage &message, int floatPrecision,
                            const PacketBuilder::TagMap &globalTags,
@@ -27,6 +27,10 @@ public:
   static PercentilesWrapper Create(double *percentilesItBegin,
                                    double *percentilesItEnd);
 
+  static PercentilesWrapper CreateApproximate(double relativeAccuracy,
+                                              double *percentilesItBegin,
+                                              double *percentilesItEnd);
+
   virtual void HandleMessage(MetricMessage &message,
                              IMetricsEnqueuer &submitter) override {
     m_impl->HandleMessage(message, submitter);
@@ -56,6 +60,39 @@ inline Internal::PercentilesWrapper Percentiles(Real... values) {
   return Internal::PercentilesWrapper::Create(valuesBegin, valuesEnd);
 }
 
+/**
+ * Default relative accuracy of ApproximatePercentiles.
+ */
+constexpr double DefaultPercentileAccuracy = 0.01;
+
+/**
+ * Emit a series of percentiles estimated from a fixed-size sketch.
+ *
+ * Unlike Percentiles, samples are not stored: each one increments a counter
+ * in a logarithmic bucket, so memory stays bounded and emitting does not sort.
+ * Every estimate is within relativeAccuracy (e.g. 0.01 for 1%) of the sample
+ * at that rank. Prefer this for high-rate timers.
+ */
+template <class... Real>
+inline Internal::PercentilesWrapper
+ApproximatePercentilesWithAccuracy(double relativeAccuracy, Real... values) {
+  std::vector<double> valuesVec = {static_cast<double>(values)...};
+  double *valuesBegin = valuesVec.data();
+  double *valuesEnd = valuesBegin + valuesVec.size();
+  return Internal::PercentilesWrapper::CreateApproximate(
+      relativeAccuracy, valuesBegin, valuesEnd);
+}
+
+/**
+ * Emit a series of percentiles estimated from a fixed-size sketch, to within
+ * DefaultPercentileAccuracy.
+ */
+template <class... Real>
+inline Internal::PercentilesWrapper ApproximatePercentiles(Real... values) {
+  return ApproximatePercentilesWithAccuracy(DefaultPercentileAccuracy,
+                                            values...);
+}
+
 /**
  * Compute the median as .p50
  */
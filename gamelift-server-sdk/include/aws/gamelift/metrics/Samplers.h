@@ -61,10 +61,26 @@ namespace Internal {
  * Opaque wrapper around seed initialization state for per-thread RNG.
  */
 struct SeedState;
+
+/**
+ * Opaque wrapper around the sample rate state of a SampleAdaptive.
+ */
+struct AdaptiveState;
+
+/**
+ * INTERNAL: starts a new capture interval for samplers that adapt their rate.
+ *
+ * Called by the metrics processor once it has written a capture, so the
+ * capture reports the rate its samples were taken at.
+ */
+GAMELIFT_METRICS_API void AdvanceSamplerInterval();
 } // namespace Internal
 
 /**
  * Takes a random fraction of all samples.
+ *
+ * Each sampler has its own small random number generator on each thread, so
+ * deciding costs a few arithmetic operations and never synchronizes.
  */
 class GAMELIFT_METRICS_API SampleFraction : public ISampler {
 public:
@@ -150,6 +166,117 @@ private:
   Internal::SeedState *m_seed;
 };
 
+/**
+ * Takes every Nth sample, starting with the first.
+ *
+ * Deterministic and needs no random numbers, so it is the cheapest way to
+ * thin out metrics logged at a high rate, e.g. once per packet. Samples are
+ * counted per thread, so each thread takes every Nth of its own samples.
+ */
+class GAMELIFT_METRICS_API SampleEveryN : public ISampler {
+public:
+  /**
+   * @param n Takes one sample out of every n. Values below 1 take every
+   * sample.
+   */
+  explicit SampleEveryN(Int64 n);
+
+  SampleEveryN(const SampleEveryN &) = delete;
+  SampleEveryN &operator=(const SampleEveryN &) = delete;
+
+  SampleEveryN(SampleEveryN &&other) = default;
+  SampleEveryN &operator=(SampleEveryN &&other) = default;
+
+  virtual bool ShouldTakeSample() override;
+
+  /**
+   * @brief Gets the sample rate for this sampler
+   * @return 1 / N
+   */
+  float GetSampleRate() const override {
+    return 1.0f / static_cast<float>(m_n);
+  }
+
+  /**
+   * @brief Gets the number of samples out of which one is taken
+   * @return N
+   */
+  Int64 GetN() const { return m_n; }
+
+private:
+  Int64 m_n;
+  // Index of this sampler's per-thread counter.
+  uint32_t m_slot;
+};
+
+/**
+ * Takes at most about maxSamplesPerInterval samples per capture interval.
+ *
+ * At the start of each capture interval, sets the fraction of samples to take
+ * from the number of samples offered in the previous interval: all of them if
+ * there were no more than maxSamplesPerInterval, otherwise
+ * maxSamplesPerInterval divided by the number offered. The fraction is
+ * reported as the sample rate, so captures are scaled back up by the metrics
+ * backend.
+ *
+ * Lets very hot code paths be instrumented without picking a fixed fraction
+ * that is too expensive at peak or too sparse when idle. The rate follows the
+ * load one interval behind, so a sudden burst or lull is sampled at the
+ * previous interval's rate until the next interval starts.
+ */
+class GAMELIFT_METRICS_API SampleAdaptive : public ISampler {
+public:
+  /**
+   * @param maxSamplesPerInterval Number of samples to take per capture
+   * interval. Values below 1 take one sample per interval.
+   *
+   * Uses current time since epoch as default seed for the random number
+   * generators.
+   */
+  explicit SampleAdaptive(Int64 maxSamplesPerInterval);
+
+  /**
+   * @param maxSamplesPerInterval Number of samples to take per capture
+   * interval. Values below 1 take one sample per interval.
+   * @param seed The integer seed for random number generators.
+   */
+  SampleAdaptive(Int64 maxSamplesPerInterval, Int64 seed);
+
+  SampleAdaptive(const SampleAdaptive &) = delete;
+  SampleAdaptive &operator=(const SampleAdaptive &) = delete;
+
+  SampleAdaptive(SampleAdaptive &&other) : m_state(other.m_state) {
+    other.m_state = nullptr;
+  }
+
+  SampleAdaptive &operator=(SampleAdaptive &&other) {
+    // other frees this sampler's old state.
+    Internal::AdaptiveState *state = m_state;
+    m_state = other.m_state;
+    other.m_state = state;
+    return *this;
+  }
+
+  ~SampleAdaptive();
+
+  virtual bool ShouldTakeSample() override;
+
+  /**
+   * @brief Gets the sample rate for this sampler
+   * @return The fraction of samples taken in the current capture interval
+   */
+  float GetSampleRate() const override;
+
+  /**
+   * @brief Gets the number of samples to take per capture interval
+   * @return The maximum number of samples per capture interval
+   */
+  Int64 GetMaxSamplesPerInterval() const;
+
+private:
+  Internal::AdaptiveState *m_state;
+};
+
 } // namespace Metrics
 } // namespace GameLift
 } // namespace Aws
@@ -13,29 +13,65 @@
 
 #include <asio.hpp>
 
-#ifdef GAMELIFT_USE_STD
+#include <cstdint>
 #include <string>
-#endif
+#include <utility>
+#include <vector>
 
 namespace Aws {
 namespace GameLift {
 namespace Metrics {
 
+/**
+ * Sends StatsD packets over a non-blocking UDP socket.
+ *
+ * Packets are queued by Send and handed to the kernel in batches by Flush, with
+ * a single sendmmsg call per batch on Linux. A packet the socket can't take
+ * right away is dropped and counted rather than retried, and the rest of its
+ * batch is still sent. Packets still queued are sent on destruction.
+ */
 class StatsDClient {
 public:
+    // Packets queued before Send flushes on its own.
+    static constexpr size_t MAX_BATCH_PACKETS = 64;
+
 #ifdef GAMELIFT_USE_STD
     StatsDClient(const std::string& host, int port);
 #else
     StatsDClient(const char* host, int port);
 #endif
-    ~StatsDClient() = default;
+    ~StatsDClient();
 
+    /**
+     * Queues a packet. The data is copied.
+     */
     void Send(const char* data, int size);
 
+    /**
+     * Sends all queued packets.
+     */
+    void Flush();
+
+    /**
+     * Number of packets dropped since the client was created. Drops are also
+     * logged by Flush.
+     */
+    uint64_t GetDroppedPacketCount() const { return m_droppedPacketCount; }
+
 private:
+    void SendBatch();
+    void DropPackets(size_t count, const char* reason);
+
     asio::io_service m_io_service;
     asio::ip::udp::socket m_socket;
     asio::ip::udp::endpoint m_endpoint;
+
+    // Queued packets, back to back, with the offset and size of each.
+    std::vector<char> m_batchBuffer;
+    std::vector<std::pair<size_t, size_t>> m_batchPackets;
+    uint64_t m_droppedPacketCount = 0;
+    uint64_t m_unreportedDroppedPacketCount = 0;
+    std::string m_lastDropReason;
 };
 
 } // namespace Metrics
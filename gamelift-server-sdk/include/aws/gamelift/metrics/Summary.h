@@ -0,0 +1,181 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/metrics/DerivedMetric.h>
+#include <aws/gamelift/metrics/DynamicMetric.h>
+#include <aws/gamelift/metrics/KeySuffix.h>
+
+#include <math.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Metrics {
+
+/**
+ * @brief Logs the count, sum, minimum and maximum of all values seen during
+ * the capture period, and optionally their standard deviation.
+ *
+ * Equivalent to Count, Sum, Min and Max, but updated once per message and
+ * emitted together. Logged as `metric.count`, `metric.sum`, `metric.min`,
+ * `metric.max` and `metric.stddev`.
+ */
+class Summary : public IDerivedMetric {
+public:
+  Summary() = default;
+
+  /**
+   * @param withStdDev Also log the population standard deviation.
+   */
+  explicit Summary(bool withStdDev) : m_withStdDev(withStdDev) {}
+
+  /**
+   * @brief Gets whether the standard deviation is logged
+   * @return True if `metric.stddev` is logged
+   */
+  bool IsWithStdDev() const { return m_withStdDev; }
+
+  /**
+   * @brief Sets whether the standard deviation is logged
+   * @param withStdDev Also log the population standard deviation
+   */
+  void SetWithStdDev(bool withStdDev) { m_withStdDev = withStdDev; }
+
+  /**
+   * @brief Fluent setter for logging the standard deviation
+   * @param withStdDev Also log the population standard deviation
+   * @return Reference to this object for method chaining
+   */
+  Summary &WithStdDev(bool withStdDev) {
+    SetWithStdDev(withStdDev);
+    return *this;
+  }
+
+  virtual void HandleMessage(MetricMessage &message,
+                             IMetricsEnqueuer &submitter) override {
+    switch (message.Type) {
+    case MetricMessageType::GaugeAdd:
+      m_currentValue += message.SubmitDouble.Value;
+      AddValue(m_currentValue);
+      break;
+    case MetricMessageType::GaugeSet:
+    case MetricMessageType::TimerSet:
+      m_currentValue = message.SubmitDouble.Value;
+      AddValue(m_currentValue);
+      break;
+    case MetricMessageType::TagSet:
+    case MetricMessageType::TagRemove:
+      CopyTagMessage(message, m_countMetric, submitter);
+      CopyTagMessage(message, m_sumMetric, submitter);
+      CopyTagMessage(message, m_minMetric, submitter);
+      CopyTagMessage(message, m_maxMetric, submitter);
+      if (m_withStdDev) {
+        CopyTagMessage(message, m_stdDevMetric, submitter);
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  virtual void EmitMetrics(const IMetric *originalMetric,
+                           IMetricsEnqueuer &submitter) override {
+    if (m_count == 0) {
+      return;
+    }
+
+    if (!m_metricsInitialized) {
+      InitializeMetric(".count", *originalMetric, m_countMetric);
+      InitializeMetric(".sum", *originalMetric, m_sumMetric);
+      InitializeMetric(".min", *originalMetric, m_minMetric);
+      InitializeMetric(".max", *originalMetric, m_maxMetric);
+      InitializeMetric(".stddev", *originalMetric, m_stdDevMetric);
+      m_metricsInitialized = true;
+    }
+
+    Emit(m_countMetric, static_cast<double>(m_count), submitter);
+    Emit(m_sumMetric, m_sum, submitter);
+    Emit(m_minMetric, m_min, submitter);
+    Emit(m_maxMetric, m_max, submitter);
+    if (m_withStdDev) {
+      Emit(m_stdDevMetric, sqrt(m_sumOfSquaredDeviations / m_count),
+           submitter);
+    }
+
+    m_count = 0;
+    m_sum = 0;
+    m_mean = 0;
+    m_sumOfSquaredDeviations = 0;
+  }
+
+private:
+  void AddValue(double value) {
+    if (m_count == 0) {
+      m_min = value;
+      m_max = value;
+    } else {
+      m_min = value < m_min ? value : m_min;
+      m_max = value > m_max ? value : m_max;
+    }
+    ++m_count;
+    m_sum += value;
+
+    // Welford's algorithm, which stays accurate where a plain sum of squares
+    // would cancel out.
+    const double delta = value - m_mean;
+    m_mean += delta / m_count;
+    m_sumOfSquaredDeviations += delta * (value - m_mean);
+  }
+
+  static void InitializeMetric(const char *suffix, const IMetric &original,
+                               DynamicMetric &metric) {
+    KeySuffix(suffix).Apply(original, metric);
+    metric.SetMetricType(original.GetMetricType());
+  }
+
+  static void Emit(DynamicMetric &metric, double value,
+                   IMetricsEnqueuer &submitter) {
+    switch (metric.GetMetricType()) {
+    case MetricType::Gauge:
+      submitter.Enqueue(MetricMessage::GaugeSet(metric, value));
+      break;
+    case MetricType::Timer:
+      submitter.Enqueue(MetricMessage::TimerSet(metric, value));
+      break;
+    default:
+      break;
+    }
+  }
+
+private:
+  bool m_withStdDev = false;
+
+  size_t m_count = 0;
+  double m_sum = 0;
+  double m_min = 0;
+  double m_max = 0;
+  double m_mean = 0;
+  double m_sumOfSquaredDeviations = 0;
+  double m_currentValue = 0;
+
+  DynamicMetric m_countMetric;
+  DynamicMetric m_sumMetric;
+  DynamicMetric m_minMetric;
+  DynamicMetric m_maxMetric;
+  DynamicMetric m_stdDevMetric;
+  bool m_metricsInitialized = false;
+};
+
+} // namespace Metrics
+} // namespace GameLift
+} // namespace Aws
@@ -16,6 +16,7 @@
 #include <aws/gamelift/metrics/InternalTypes.h>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class DynamicTag;
 using namespace ::Aws::GameLift::Metrics;
@@ -38,12 +39,12 @@ public:
    */
   const std::unordered_map<std::string, std::string> &
   GetTags(const IMetric *metric) const {
-    auto it = m_tags.find(metric);
-    if (it == std::end(m_tags)) {
+    const MetricId id = metric->GetId();
+    if (id >= m_tags.size()) {
       static const std::unordered_map<std::string, std::string> emptyMap;
       return emptyMap;
     }
-    return it->second;
+    return m_tags[id];
   }
 
 private:
@@ -51,7 +52,6 @@ private:
   void HandleRemove(const IMetric *metric, MetricSetTag &message);
 
 private:
-  std::unordered_map<const IMetric *,
-                     std::unordered_map<std::string, std::string>>
-      m_tags;
+  // Indexed by metric id.
+  std::vector<std::unordered_map<std::string, std::string>> m_tags;
 };
\ No newline at end of file
@@ -0,0 +1,65 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/metrics/IMetricsProcessor.h>
+#include <aws/gamelift/metrics/InternalTypes.h>
+
+#include <mutex>
+#include <vector>
+
+using namespace ::Aws::GameLift::Metrics;
+
+/**
+ * Pre-aggregates the counters and gauges logged by one thread in the current
+ * capture period.
+ *
+ * Counters are summed and gauges keep their latest value, so each metric is
+ * handed to the processor as a single message per capture. Metrics with
+ * derived metrics are not aggregated, since derived metrics need every value.
+ *
+ * The owning thread adds messages while the processor drains them. Both take a
+ * lock that is only contended while a drain is in progress.
+ */
+class ThreadAggregator final {
+public:
+  /**
+   * @brief Aggregates message into the thread's per-metric state.
+   *
+   * @param message Message to aggregate.
+   *
+   * @return False if the message can't be aggregated and must be queued as is.
+   */
+  bool TryAdd(const MetricMessage &message);
+
+  /**
+   * @brief Appends one message per metric aggregated since the last drain, and
+   * resets them.
+   *
+   * @param messages Vector to append the aggregated messages to.
+   */
+  void Drain(std::vector<MetricMessage> &messages);
+
+private:
+  struct Slot {
+    // None while nothing has been aggregated in the current capture period.
+    MetricMessageType Type = MetricMessageType::None;
+    double Value = 0;
+  };
+
+private:
+  std::mutex m_mutex;
+  // Indexed by metric id.
+  std::vector<Slot> m_slots;
+  std::vector<IMetric *> m_aggregatedMetrics;
+};
@@ -165,6 +165,48 @@ AWS_GAMELIFT_API GenericOutcome RemovePlayerSession(const std::string &playerSes
 AWS_GAMELIFT_API DescribePlayerSessionsOutcome
 DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest);
 
+/*
+ * Asynchronous variants of the calls above. They return immediately with a future that becomes
+ * ready with the same outcome the blocking call would have returned. Waiting for the response and
+ * any retries happens on an SDK-owned thread, so these are safe to call from a game loop that
+ * polls the future instead of blocking on it.
+ */
+
+/**
+    Asynchronous version of AcceptPlayerSession().
+    @param playerSessionId the ID of the joining player's session.
+    @return A future for the outcome of the call.
+ */
+AWS_GAMELIFT_API GenericOutcomeCallable AcceptPlayerSessionAsync(const std::string &playerSessionId);
+
+/**
+    Asynchronous version of RemovePlayerSession().
+    @param playerSessionId the ID of the leaving player's session.
+    @return A future for the outcome of the call.
+ */
+AWS_GAMELIFT_API GenericOutcomeCallable RemovePlayerSessionAsync(const std::string &playerSessionId);
+
+/**
+    Asynchronous version of DescribePlayerSessions().
+    @return A future for the outcome of the call.
+ */
+AWS_GAMELIFT_API DescribePlayerSessionsOutcomeCallable
+DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest);
+
+/**
+    Asynchronous version of StartMatchBackfill().
+    @return A future for the outcome of the call.
+ */
+AWS_GAMELIFT_API StartMatchBackfillOutcomeCallable
+StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest);
+
+/**
+    Asynchronous version of GetFleetRoleCredentials().
+    @return A future for the outcome of the call.
+ */
+AWS_GAMELIFT_API GetFleetRoleCredentialsOutcomeCallable
+GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request);
+
 #else
 /**
 @return The current SDK version.
@@ -312,6 +354,59 @@ AWS_GAMELIFT_API GenericOutcome RemovePlayerSession(const char *playerSessionId)
 AWS_GAMELIFT_API DescribePlayerSessionsOutcome
 DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest);
 
+typedef void (*GenericOutcomeAsyncHandler)(const GenericOutcome &outcome, void *state);
+typedef void (*DescribePlayerSessionsOutcomeAsyncHandler)(const DescribePlayerSessionsOutcome &outcome, void *state);
+typedef void (*StartMatchBackfillOutcomeAsyncHandler)(const StartMatchBackfillOutcome &outcome, void *state);
+typedef void (*GetFleetRoleCredentialsOutcomeAsyncHandler)(const GetFleetRoleCredentialsOutcome &outcome, void *state);
+
+/*
+ * Asynchronous variants of the calls above. They return immediately, and the handler is later
+ * invoked with the same outcome the blocking call would have returned, along with the given state
+ * pointer. Handlers run on an SDK-owned thread and should return quickly. If the SDK is not
+ * initialized or the process is not ready, the handler is invoked before the call returns. A null
+ * handler is allowed when the outcome isn't needed.
+ */
+
+/**
+Asynchronous version of AcceptPlayerSession().
+@param playerSessionId the ID of the joining player's session.
+@param onComplete handler invoked with the outcome of the call.
+@param state passed to onComplete.
+*/
+AWS_GAMELIFT_API void AcceptPlayerSessionAsync(const char *playerSessionId, GenericOutcomeAsyncHandler onComplete, void *state);
+
+/**
+Asynchronous version of RemovePlayerSession().
+@param playerSessionId the ID of the leaving player's session.
+@param onComplete handler invoked with the outcome of the call.
+@param state passed to onComplete.
+*/
+AWS_GAMELIFT_API void RemovePlayerSessionAsync(const char *playerSessionId, GenericOutcomeAsyncHandler onComplete, void *state);
+
+/**
+Asynchronous version of DescribePlayerSessions().
+@param onComplete handler invoked with the outcome of the call.
+@param state passed to onComplete.
+*/
+AWS_GAMELIFT_API void DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                                  DescribePlayerSessionsOutcomeAsyncHandler onComplete, void *state);
+
+/**
+Asynchronous version of StartMatchBackfill().
+@param onComplete handler invoked with the outcome of the call.
+@param state passed to onComplete.
+*/
+AWS_GAMELIFT_API void StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                              StartMatchBackfillOutcomeAsyncHandler onComplete, void *state);
+
+/**
+Asynchronous version of GetFleetRoleCredentials().
+@param onComplete handler invoked with the outcome of the call.
+@param state passed to onComplete.
+*/
+AWS_GAMELIFT_API void GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                   GetFleetRoleCredentialsOutcomeAsyncHandler onComplete, void *state);
+
 #endif
 
 /**
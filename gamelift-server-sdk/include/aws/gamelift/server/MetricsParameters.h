@@ -33,7 +33,7 @@ public:
     MetricsParameters(const std::string &statsDHost, int statsDPort, const std::string &crashReporterHost, 
                      int crashReporterPort, int flushIntervalMs, int maxPacketSize)
         : m_statsDHost(statsDHost), m_statsDPort(statsDPort), m_crashReporterHost(crashReporterHost), 
-          m_crashReporterPort(crashReporterPort), m_flushIntervalMs(flushIntervalMs), m_maxPacketSize(maxPacketSize) {}
+          m_crashReporterPort(crashReporterPort), m_flushIntervalMs(flushIntervalMs), m_maxPacketSize(maxPacketSize), m_backgroundFlush(false) {}
 
     MetricsParameters(const MetricsParameters &) = default;
     MetricsParameters(MetricsParameters &&) = default;
@@ -46,6 +46,8 @@ public:
     inline int GetMaxPacketSize() const { return m_maxPacketSize; }
     inline const std::string &GetCrashReporterHost() const { return m_crashReporterHost; }
     inline int GetCrashReporterPort() const { return m_crashReporterPort; }
+    // Whether metrics are processed and sent on a background thread every flush interval, instead of by MetricsProcess().
+    inline bool GetBackgroundFlush() const { return m_backgroundFlush; }
 
     inline void SetStatsDHost(const std::string &statsDHost) { m_statsDHost = statsDHost; }
     inline void SetStatsDPort(int statsDPort) { m_statsDPort = statsDPort; }
@@ -53,6 +55,7 @@ public:
     inline void SetMaxPacketSize(int maxPacketSize) { m_maxPacketSize = maxPacketSize; }
     inline void SetCrashReporterHost(const std::string &crashReporterHost) { m_crashReporterHost = crashReporterHost; }
     inline void SetCrashReporterPort(int crashReporterPort) { m_crashReporterPort = crashReporterPort; }
+    inline void SetBackgroundFlush(bool backgroundFlush) { m_backgroundFlush = backgroundFlush; }
 
 private:
     std::string m_statsDHost;
@@ -61,12 +64,14 @@ private:
     int m_crashReporterPort;
     int m_flushIntervalMs;
     int m_maxPacketSize;
+    bool m_backgroundFlush;
 
 #else
 public:
     MetricsParameters(const char *statsDHost, int statsDPort, const char *crashReporterHost, 
                      int crashReporterPort, int flushIntervalMs, int maxPacketSize) 
-        : m_statsDPort(statsDPort), m_crashReporterPort(crashReporterPort), m_flushIntervalMs(flushIntervalMs), m_maxPacketSize(maxPacketSize) {
+        : m_statsDPort(statsDPort), m_crashReporterPort(crashReporterPort), m_flushIntervalMs(flushIntervalMs), m_maxPacketSize(maxPacketSize),
+          m_backgroundFlush(false) {
         if (statsDHost != nullptr) {
             strncpy(m_statsDHost, statsDHost, MAX_STATSD_HOST_LENGTH - 1);
             m_statsDHost[MAX_STATSD_HOST_LENGTH - 1] = '\0';
@@ -78,7 +83,8 @@ public:
     }
 
     MetricsParameters(const MetricsParameters &other) : m_statsDPort(other.m_statsDPort), m_crashReporterPort(other.m_crashReporterPort), 
-                                                       m_flushIntervalMs(other.m_flushIntervalMs), m_maxPacketSize(other.m_maxPacketSize) {
+                                                       m_flushIntervalMs(other.m_flushIntervalMs), m_maxPacketSize(other.m_maxPacketSize),
+                                                       m_backgroundFlush(other.m_backgroundFlush) {
         strncpy(m_statsDHost, other.m_statsDHost, MAX_STATSD_HOST_LENGTH - 1);
         m_statsDHost[MAX_STATSD_HOST_LENGTH - 1] = '\0';
         strncpy(m_crashReporterHost, other.m_crashReporterHost, MAX_CRASH_REPORTER_HOST_LENGTH - 1);
@@ -91,6 +97,7 @@ public:
             m_flushIntervalMs = other.m_flushIntervalMs;
             m_maxPacketSize = other.m_maxPacketSize;
             m_crashReporterPort = other.m_crashReporterPort;
+            m_backgroundFlush = other.m_backgroundFlush;
             strncpy(m_statsDHost, other.m_statsDHost, MAX_STATSD_HOST_LENGTH - 1);
             m_statsDHost[MAX_STATSD_HOST_LENGTH - 1] = '\0';
             strncpy(m_crashReporterHost, other.m_crashReporterHost, MAX_CRASH_REPORTER_HOST_LENGTH - 1);
@@ -105,6 +112,8 @@ public:
     inline int GetMaxPacketSize() const { return m_maxPacketSize; }
     inline const char *GetCrashReporterHost() const { return m_crashReporterHost; }
     inline int GetCrashReporterPort() const { return m_crashReporterPort; }
+    // Whether metrics are processed and sent on a background thread every flush interval, instead of by MetricsProcess().
+    inline bool GetBackgroundFlush() const { return m_backgroundFlush; }
 
     inline void SetStatsDHost(const char *statsDHost) {
         if (statsDHost != nullptr) {
@@ -122,6 +131,7 @@ public:
         }
     }
     inline void SetCrashReporterPort(int crashReporterPort) { m_crashReporterPort = crashReporterPort; }
+    inline void SetBackgroundFlush(bool backgroundFlush) { m_backgroundFlush = backgroundFlush; }
 
 private:
     char m_statsDHost[MAX_STATSD_HOST_LENGTH];
@@ -130,6 +140,7 @@ private:
     int m_crashReporterPort;
     int m_flushIntervalMs;
     int m_maxPacketSize;
+    bool m_backgroundFlush;
 #endif
 };
 
@@ -25,6 +25,12 @@ typedef void (*StartGameSessionFn)(Aws::GameLift::Server::Model::GameSession, vo
 typedef void (*UpdateGameSessionFn)(Aws::GameLift::Server::Model::UpdateGameSession, void *);
 typedef void (*ProcessTerminateFn)(void *);
 typedef bool (*HealthCheckFn)(void *);
+// Runs one SDK callback task. The executor must eventually call task(taskState) exactly once, on any thread.
+typedef void (*CallbackTaskFn)(void *taskState);
+typedef void (*CallbackExecutorFn)(CallbackTaskFn task, void *taskState, void *executorState);
+#else
+// Runs one SDK callback task. The executor must eventually call task() exactly once, on any thread.
+typedef std::function<void(const std::function<void()> &task)> CallbackExecutor;
 #endif
 
 class ProcessParameters {
@@ -32,19 +38,20 @@ class ProcessParameters {
 public:
     ProcessParameters()
         : m_onStartGameSession(nullptr), m_onUpdateGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_port(-1),
-          m_logParameters(LogParameters()) {}
+          m_logParameters(LogParameters()), m_callbackExecutor(nullptr) {}
 
     ProcessParameters(const std::function<void(Aws::GameLift::Server::Model::GameSession)> onStartGameSession, const std::function<void()> onProcessTerminate,
                       const std::function<bool()> onHealthCheck, int port, const Aws::GameLift::Server::LogParameters logParameters)
         : m_onStartGameSession(onStartGameSession), m_onUpdateGameSession([](const Aws::GameLift::Server::Model::UpdateGameSession &) {}),
-          m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters) {}
+          m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters),
+          m_callbackExecutor(nullptr) {}
 
     ProcessParameters(const std::function<void(Aws::GameLift::Server::Model::GameSession)> onStartGameSession,
                       const std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> onUpdateGameSession,
                       const std::function<void()> onProcessTerminate, const std::function<bool()> onHealthCheck, int port,
                       const Aws::GameLift::Server::LogParameters logParameters)
         : m_onStartGameSession(onStartGameSession), m_onUpdateGameSession(onUpdateGameSession), m_onProcessTerminate(onProcessTerminate),
-          m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters) {}
+          m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters), m_callbackExecutor(nullptr) {}
 
     AWS_GAMELIFT_API std::function<void(Aws::GameLift::Server::Model::GameSession)> getOnStartGameSession() const { return m_onStartGameSession; }
     AWS_GAMELIFT_API std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> getOnUpdateGameSession() const { return m_onUpdateGameSession; }
@@ -52,6 +59,14 @@ public:
     AWS_GAMELIFT_API std::function<bool()> getOnHealthCheck() const { return m_onHealthCheck; }
     AWS_GAMELIFT_API int getPort() const { return m_port; }
     AWS_GAMELIFT_API Aws::GameLift::Server::LogParameters getLogParameters() const { return m_logParameters; }
+    AWS_GAMELIFT_API CallbackExecutor getCallbackExecutor() const { return m_callbackExecutor; }
+
+    /**
+     * Optional. Runs onStartGameSession, onUpdateGameSession, onProcessTerminate and onHealthCheck on
+     * the given executor (e.g. the game's own job system). By default they run on a small pool of SDK
+     * threads.
+     */
+    AWS_GAMELIFT_API void setCallbackExecutor(const CallbackExecutor &callbackExecutor) { m_callbackExecutor = callbackExecutor; }
 
 private:
     std::function<void(Aws::GameLift::Server::Model::GameSession)> m_onStartGameSession;
@@ -60,11 +75,13 @@ private:
     std::function<bool()> m_onHealthCheck;
     int m_port;
     Aws::GameLift::Server::LogParameters m_logParameters;
+    CallbackExecutor m_callbackExecutor;
 #else
 public:
     ProcessParameters()
         : m_onStartGameSession(nullptr), m_onUpdateGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr),
-          m_startGameSessionState(nullptr), m_processTerminateState(nullptr), m_healthCheckState(nullptr), m_port(-1), m_logParameters(LogParameters()) {}
+          m_startGameSessionState(nullptr), m_processTerminateState(nullptr), m_healthCheckState(nullptr), m_port(-1), m_logParameters(LogParameters()),
+          m_callbackExecutor(nullptr), m_callbackExecutorState(nullptr) {}
 
     ProcessParameters(StartGameSessionFn onStartGameSession, void *startGameSessionState, UpdateGameSessionFn onUpdateGameSession, void *updateGameSessionState,
                       ProcessTerminateFn onProcessTerminate, void *processTerminateState, HealthCheckFn onHealthCheck, void *healthCheckState, int port,
@@ -73,7 +90,8 @@ public:
 
           m_onStartGameSession(onStartGameSession), m_onUpdateGameSession(onUpdateGameSession), m_onProcessTerminate(onProcessTerminate),
           m_onHealthCheck(onHealthCheck), m_startGameSessionState(startGameSessionState), m_updateGameSessionState(updateGameSessionState),
-          m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port), m_logParameters(logParameters) {}
+          m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port), m_logParameters(logParameters),
+          m_callbackExecutor(nullptr), m_callbackExecutorState(nullptr) {}
 
     ProcessParameters(StartGameSessionFn onStartGameSession, void *startGameSessionState, ProcessTerminateFn onProcessTerminate, void *processTerminateState,
                       HealthCheckFn onHealthCheck, void *healthCheckState, int port, const Aws::GameLift::Server::LogParameters logParameters)
@@ -82,7 +100,7 @@ public:
           m_onStartGameSession(onStartGameSession), m_onUpdateGameSession([](Aws::GameLift::Server::Model::UpdateGameSession, void *) {}),
           m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_startGameSessionState(startGameSessionState),
           m_updateGameSessionState(nullptr), m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port),
-          m_logParameters(logParameters) {}
+          m_logParameters(logParameters), m_callbackExecutor(nullptr), m_callbackExecutorState(nullptr) {}
 
     AWS_GAMELIFT_API StartGameSessionFn getOnStartGameSession() const { return m_onStartGameSession; }
     AWS_GAMELIFT_API void *getStartGameSessionState() const { return m_startGameSessionState; }
@@ -94,6 +112,18 @@ public:
     AWS_GAMELIFT_API void *getHealthCheckState() const { return m_healthCheckState; }
     AWS_GAMELIFT_API int getPort() const { return m_port; }
     AWS_GAMELIFT_API Aws::GameLift::Server::LogParameters getLogParameters() const { return m_logParameters; }
+    AWS_GAMELIFT_API CallbackExecutorFn getCallbackExecutor() const { return m_callbackExecutor; }
+    AWS_GAMELIFT_API void *getCallbackExecutorState() const { return m_callbackExecutorState; }
+
+    /**
+     * Optional. Runs onStartGameSession, onUpdateGameSession, onProcessTerminate and onHealthCheck on
+     * the given executor (e.g. the game's own job system). By default they run on a small pool of SDK
+     * threads.
+     */
+    AWS_GAMELIFT_API void setCallbackExecutor(CallbackExecutorFn callbackExecutor, void *callbackExecutorState) {
+        m_callbackExecutor = callbackExecutor;
+        m_callbackExecutorState = callbackExecutorState;
+    }
 
 private:
     StartGameSessionFn m_onStartGameSession;
@@ -106,6 +136,8 @@ private:
     void *m_healthCheckState;
     int m_port;
     Aws::GameLift::Server::LogParameters m_logParameters;
+    CallbackExecutorFn m_callbackExecutor;
+    void *m_callbackExecutorState;
 #endif
 };
 } // namespace Server
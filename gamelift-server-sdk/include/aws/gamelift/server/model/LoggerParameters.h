@@ -0,0 +1,172 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/GameLift_EXPORTS.h>
+#include <stddef.h>
+
+#ifdef GAMELIFT_USE_STD
+#include <functional>
+#endif
+
+namespace Aws {
+namespace GameLift {
+namespace Server {
+namespace Model {
+
+// Mixed case, since names like DEBUG and ERR are commonly defined as macros.
+enum class LogLevel { Trace, Debug, Info, Warn, Error, Critical, Off };
+
+// What an asynchronous logger does when its queue is full.
+enum class LogOverflowPolicy {
+    // Wait for the logging thread to make room. No line is lost, but the logging thread can stall the caller.
+    BLOCK,
+    // Drop the oldest queued line. Logging never blocks the caller.
+    OVERRUN_OLDEST
+};
+
+#ifdef GAMELIFT_USE_STD
+// Receives the message of every SDK log line, without timestamp or level prefix.
+typedef std::function<void(LogLevel level, const char *message, size_t length)> LogSink;
+#else
+// Receives the message of every SDK log line, without timestamp or level prefix, along with the state that was registered with it.
+typedef void (*LogSinkFn)(LogLevel level, const char *message, size_t length, void *state);
+#endif
+
+/**
+ * Configures the SDK's own logger, which writes to the console and to logs/gamelift-server-sdk-<processId>.log.
+ * Not to be confused with LogParameters, which lists the game server's log files for upload.
+ *
+ * By default every line is written and flushed on the calling thread. With asynchronous logging enabled
+ * lines are queued for a background thread instead, so logging costs the caller a queue push.
+ */
+class AWS_GAMELIFT_API LoggerParameters {
+public:
+    static constexpr int DEFAULT_ASYNC_QUEUE_SIZE = 8192;
+
+#ifdef GAMELIFT_USE_STD
+    LoggerParameters()
+        : m_asyncLogging(false), m_asyncQueueSize(DEFAULT_ASYNC_QUEUE_SIZE), m_overflowPolicy(LogOverflowPolicy::OVERRUN_OLDEST), m_logLevel(LogLevel::Info),
+          m_flushLevel(LogLevel::Info), m_flushIntervalSeconds(0), m_logSink(nullptr) {}
+#else
+    LoggerParameters()
+        : m_asyncLogging(false), m_asyncQueueSize(DEFAULT_ASYNC_QUEUE_SIZE), m_overflowPolicy(LogOverflowPolicy::OVERRUN_OLDEST), m_logLevel(LogLevel::Info),
+          m_flushLevel(LogLevel::Info), m_flushIntervalSeconds(0), m_logSink(nullptr), m_logSinkState(nullptr) {}
+#endif
+
+    inline bool IsAsyncLogging() const { return m_asyncLogging; }
+
+    inline int GetAsyncQueueSize() const { return m_asyncQueueSize; }
+
+    inline LogOverflowPolicy GetOverflowPolicy() const { return m_overflowPolicy; }
+
+    inline LogLevel GetLogLevel() const { return m_logLevel; }
+
+    inline LogLevel GetFlushLevel() const { return m_flushLevel; }
+
+    inline int GetFlushIntervalSeconds() const { return m_flushIntervalSeconds; }
+
+    // Queue lines for a background thread instead of writing them on the calling thread.
+    inline void SetAsyncLogging(bool asyncLogging) { m_asyncLogging = asyncLogging; }
+
+    // Number of lines the asynchronous queue holds. Only read the first time an asynchronous logger is set up in the process.
+    inline void SetAsyncQueueSize(int asyncQueueSize) { m_asyncQueueSize = asyncQueueSize; }
+
+    inline void SetOverflowPolicy(LogOverflowPolicy overflowPolicy) { m_overflowPolicy = overflowPolicy; }
+
+    // Lines below this level are discarded.
+    inline void SetLogLevel(LogLevel logLevel) { m_logLevel = logLevel; }
+
+    // Lines at or above this level flush the sinks immediately.
+    inline void SetFlushLevel(LogLevel flushLevel) { m_flushLevel = flushLevel; }
+
+    // Flushes the sinks periodically from a background thread. 0 disables periodic flushing.
+    inline void SetFlushIntervalSeconds(int flushIntervalSeconds) { m_flushIntervalSeconds = flushIntervalSeconds; }
+
+    inline LoggerParameters &WithAsyncLogging(bool asyncLogging) {
+        SetAsyncLogging(asyncLogging);
+        return *this;
+    }
+
+    inline LoggerParameters &WithAsyncQueueSize(int asyncQueueSize) {
+        SetAsyncQueueSize(asyncQueueSize);
+        return *this;
+    }
+
+    inline LoggerParameters &WithOverflowPolicy(LogOverflowPolicy overflowPolicy) {
+        SetOverflowPolicy(overflowPolicy);
+        return *this;
+    }
+
+    inline LoggerParameters &WithLogLevel(LogLevel logLevel) {
+        SetLogLevel(logLevel);
+        return *this;
+    }
+
+    inline LoggerParameters &WithFlushLevel(LogLevel flushLevel) {
+        SetFlushLevel(flushLevel);
+        return *this;
+    }
+
+    inline LoggerParameters &WithFlushIntervalSeconds(int flushIntervalSeconds) {
+        SetFlushIntervalSeconds(flushIntervalSeconds);
+        return *this;
+    }
+
+#ifdef GAMELIFT_USE_STD
+    inline const LogSink &GetLogSink() const { return m_logSink; }
+
+    // Sends SDK log lines to the sink in addition to the console and log file. With asynchronous logging
+    // enabled the sink is called from the logging thread.
+    inline void SetLogSink(const LogSink &logSink) { m_logSink = logSink; }
+
+    inline LoggerParameters &WithLogSink(const LogSink &logSink) {
+        SetLogSink(logSink);
+        return *this;
+    }
+#else
+    inline LogSinkFn GetLogSink() const { return m_logSink; }
+
+    inline void *GetLogSinkState() const { return m_logSinkState; }
+
+    // Sends SDK log lines to the sink in addition to the console and log file. With asynchronous logging
+    // enabled the sink is called from the logging thread.
+    inline void SetLogSink(LogSinkFn logSink, void *logSinkState) {
+        m_logSink = logSink;
+        m_logSinkState = logSinkState;
+    }
+
+    inline LoggerParameters &WithLogSink(LogSinkFn logSink, void *logSinkState) {
+        SetLogSink(logSink, logSinkState);
+        return *this;
+    }
+#endif
+
+private:
+    bool m_asyncLogging;
+    int m_asyncQueueSize;
+    LogOverflowPolicy m_overflowPolicy;
+    LogLevel m_logLevel;
+    LogLevel m_flushLevel;
+    int m_flushIntervalSeconds;
+#ifdef GAMELIFT_USE_STD
+    LogSink m_logSink;
+#else
+    LogSinkFn m_logSink;
+    void *m_logSinkState;
+#endif
+};
+
+} // namespace Model
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
@@ -17,6 +17,7 @@
 #endif
 
 #include <aws/gamelift/common/GameLift_EXPORTS.h>
+#include <aws/gamelift/server/model/LoggerParameters.h>
 
 #ifndef GAMELIFT_USE_STD
 #ifndef MAX_WEBSOCKET_URL_LENGTH
@@ -222,6 +223,15 @@ public:
         return *this;
     }
 
+    inline const LoggerParameters &GetLoggerParameters() const { return m_loggerParameters; }
+
+    inline void SetLoggerParameters(const LoggerParameters &loggerParameters) { m_loggerParameters = loggerParameters; }
+
+    inline ServerParameters &WithLoggerParameters(const LoggerParameters &loggerParameters) {
+        SetLoggerParameters(loggerParameters);
+        return *this;
+    }
+
 private:
     std::string m_webSocketUrl;
     std::string m_fleetId;
@@ -232,6 +242,7 @@ private:
     std::string m_accessKey;
     std::string m_secretKey;
     std::string m_sessionToken;
+    LoggerParameters m_loggerParameters;
 #else
 public:
     ServerParameters() {
@@ -403,6 +414,15 @@ public:
         return *this;
     }
 
+    inline const LoggerParameters &GetLoggerParameters() const { return m_loggerParameters; }
+
+    inline void SetLoggerParameters(const LoggerParameters &loggerParameters) { m_loggerParameters = loggerParameters; }
+
+    inline ServerParameters &WithLoggerParameters(const LoggerParameters &loggerParameters) {
+        SetLoggerParameters(loggerParameters);
+        return *this;
+    }
+
 private:
     char m_webSocketUrl[MAX_WEBSOCKET_URL_LENGTH];
     char m_fleetId[MAX_FLEET_ID_LENGTH];
@@ -413,6 +433,7 @@ private:
     char m_accessKey[MAX_ACCESS_KEY_LENGTH];
     char m_secretKey[MAX_SECRET_KEY_LENGTH];
     char m_sessionToken[MAX_SESSION_TOKEN_LENGTH];
+    LoggerParameters m_loggerParameters;
 #endif
 };
 
@@ -59,25 +59,35 @@ using namespace Aws::GameLift;
 #ifdef GAMELIFT_USE_STD
 Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
     : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
-      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
+      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckGeneration(0),
+      m_healthCheckInFlight(std::make_shared<std::atomic<bool>>(false)),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
       m_terminateProcessCallback(new TerminateProcessCallback(this)), m_updateGameSessionCallback(new UpdateGameSessionCallback(this)),
       m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)),
-      m_globalProcessor(nullptr) {}
+      m_globalProcessor(nullptr), m_taskScheduler(new TaskScheduler()),
+      m_asyncReconnectInProgress(false) {
+    m_webSocketClientWrapperFactory = [] {
+        std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
+        return std::shared_ptr<IWebSocketClientWrapper>(std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer));
+    };
+}
 
 Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
+    // Stop heartbeats and asynchronous requests. Any requests that are still pending complete with an error.
+    m_taskScheduler->Shutdown();
+    // A reconnect still running uses the websocket members below. Its completion is dropped by the
+    // scheduler, which fails the request that started it.
+    if (m_asyncReconnectThread.joinable()) {
+        m_asyncReconnectThread.join();
+    }
+    // Callbacks that are already running finish on their own, this doesn't wait for them.
+    if (m_callbackThreadPool) {
+        m_callbackThreadPool->Shutdown();
+    }
+    if (m_lifecycleCallbackThreadPool) {
+        m_lifecycleCallbackThreadPool->Shutdown();
     }
 
     Aws::GameLift::Internal::GameLiftCommonState::SetInstance(nullptr);
@@ -90,7 +100,6 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     // Tell the webSocketClientManager to disconnect and delete the websocket
     if (m_webSocketClientManager) {
         m_webSocketClientManager->Disconnect();
-        delete m_webSocketClientManager;
         m_webSocketClientManager = nullptr;
     }
 
@@ -98,7 +107,14 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
 }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
-    spdlog::info("Calling ProcessReady");
+    SPDLOG_INFO("Calling ProcessReady");
+
+    // Set up where callbacks run before setting the callbacks, so there is always somewhere to dispatch them.
+    m_callbackExecutor = processParameters.getCallbackExecutor();
+    if (!m_callbackExecutor && !m_callbackThreadPool) {
+        m_callbackThreadPool = std::unique_ptr<ThreadPool>(new ThreadPool(CALLBACK_THREAD_POOL_SIZE));
+        m_lifecycleCallbackThreadPool = std::unique_ptr<ThreadPool>(new ThreadPool(1));
+    }
 
     m_onStartGameSession = processParameters.getOnStartGameSession();
     m_onUpdateGameSession = processParameters.getOnUpdateGameSession();
@@ -129,46 +145,56 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
     if (result.IsSuccess()) {
-        spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting m_healthCheckThread().");
+        SPDLOG_INFO("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting health checks.");
         m_processReady = true;
-        m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
+        StartHealthCheck();
     } else {
-        spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
+        SPDLOG_INFO("Error while executing ActivateServerProcess. See the root cause error for more information.");
     }
 
     return result;
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
-    spdlog::info("Calling ReportHealth");
-    std::future<bool> future(std::async([]() { return true; }));
-    if (m_onHealthCheck) {
-        future = std::async(std::launch::async, m_onHealthCheck);
+    SPDLOG_INFO("Calling ReportHealth");
+    std::shared_ptr<bool> healthReported = std::make_shared<bool>(false);
+    if (!m_onHealthCheck) {
+        ReportHealthStatus(healthReported, true);
+        return;
     }
 
-    // Static variable not guaranteed to be defined (location in memory) at this point unless C++
-    // 17+. Creating temp int to pass by reference.
-    std::chrono::system_clock::time_point timeoutSeconds = std::chrono::system_clock::now() + std::chrono::milliseconds(int(HEALTHCHECK_TIMEOUT_MILLIS));
-    bool health = false;
-
-    // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-        spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
-    } else {
-        spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+    // Don't pile up calls behind a health check that is still running, report unhealthy for this beat instead.
+    if (m_healthCheckInFlight->exchange(true)) {
+        SPDLOG_WARN("Previous health check for server process {} is still running. Reporting as unhealthy.", m_processId);
+        ReportHealthStatus(healthReported, false);
+        return;
     }
 
-    Aws::GameLift::Internal::HeartbeatServerProcessRequest request = Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(health);
-    if (m_webSocketClientManager || m_webSocketClientWrapper) {
-        spdlog::info("Trying to report process health as {} for process {}", health, m_processId);
-        auto outcome = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
-        if (!outcome.IsSuccess()) {
-	        spdlog::error("Error reporting process health for process {}.", m_processId);
+    // Report unhealthy if the developer callback doesn't answer in time
+    m_taskScheduler->PostAfter(HEALTHCHECK_TIMEOUT_MILLIS, [this, healthReported] {
+        if (!*healthReported) {
+            SPDLOG_WARN("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+            ReportHealthStatus(healthReported, false);
         }
-    } else {
-	    spdlog::error("Tried to report process health for process {} with no active connection", m_processId);
-    }
+    });
+
+    std::function<bool()> onHealthCheck = m_onHealthCheck;
+    std::shared_ptr<TaskScheduler> taskScheduler = m_taskScheduler;
+    std::shared_ptr<std::atomic<bool>> healthCheckInFlight = m_healthCheckInFlight;
+    DispatchCallback(m_callbackThreadPool.get(), "OnHealthCheck", [this, onHealthCheck, taskScheduler, healthCheckInFlight, healthReported] {
+        bool health = false;
+        try {
+            health = onHealthCheck();
+        } catch (const std::exception &e) {
+            SPDLOG_ERROR("Exception thrown by health check callback: {}", e.what());
+        } catch (...) {
+            SPDLOG_ERROR("Unknown exception thrown by health check callback");
+        }
+        *healthCheckInFlight = false;
+        // Hop back onto the task scheduler. If the SDK was destroyed in the meantime the scheduler
+        // has shut down and drops the task, so "this" is never touched.
+        taskScheduler->Post([this, healthReported, health] { ReportHealthStatus(healthReported, health); });
+    });
 }
 
 ::GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() {
@@ -292,13 +318,12 @@ void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameL
     // Call metrics OnGameSessionStarted
     if (!gameSessionId.empty() && m_globalProcessor != nullptr) {
         Aws::GameLift::Metrics::OnGameSessionStarted(gameSession);
-        spdlog::info("Tagged metrics with game session: {}", gameSessionId);
+        SPDLOG_INFO("Tagged metrics with game session: {}", gameSessionId);
     }
 
     // Invoking OnStartGameSession callback if specified by the developer.
     if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession));
-        activateGameSession.detach();
+        DispatchCallback(m_lifecycleCallbackThreadPool.get(), "OnStartGameSession", std::bind(m_onStartGameSession, gameSession));
     }
 }
 
@@ -312,10 +337,9 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
 
     // Invoking OnProcessTerminate callback if specified by the developer.
     if (m_onProcessTerminate) {
-        std::thread terminateProcess(std::bind(m_onProcessTerminate));
-        terminateProcess.detach();
+        DispatchCallback(m_lifecycleCallbackThreadPool.get(), "OnProcessTerminate", m_onProcessTerminate);
     } else {
-        spdlog::info("OnProcessTerminate handler is not defined. Calling ProcessEnding() and Destroy()");
+        SPDLOG_INFO("OnProcessTerminate handler is not defined. Calling ProcessEnding() and Destroy()");
         GenericOutcome processEndingResult = ProcessEnding();
         GenericOutcome destroyResult = DestroyInstance();
         if (processEndingResult.IsSuccess() && destroyResult.IsSuccess()) {
@@ -323,10 +347,10 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
         }
         else {
             if (!processEndingResult.IsSuccess()) {
-                spdlog::error("Failed to call ProcessEnding().");
+                SPDLOG_ERROR("Failed to call ProcessEnding().");
             }
             if (!destroyResult.IsSuccess()) {
-                spdlog::error("Failed to call Destroy().");
+                SPDLOG_ERROR("Failed to call Destroy().");
             }
             exit(-1);
         }
@@ -340,8 +364,7 @@ void Aws::GameLift::Internal::GameLiftServerState::OnUpdateGameSession(Aws::Game
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
     if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession));
-        updateGameSessionThread.detach();
+        DispatchCallback(m_lifecycleCallbackThreadPool.get(), "OnUpdateGameSession", std::bind(m_onUpdateGameSession, updateGameSession));
     }
 }
 
@@ -351,11 +374,14 @@ void Aws::GameLift::Internal::GameLiftServerState::OnRefreshConnection(const std
     }
     m_connectionEndpoint = refreshConnectionEndpoint;
     m_authToken = authToken;
-    spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
-    m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    SPDLOG_INFO("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
+    GetWebSocketClientManager()->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
 }
 
-bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
+bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() {
+    std::shared_ptr<GameLiftWebSocketClientManager> webSocketClientManager = GetWebSocketClientManager();
+    return !webSocketClientManager || !webSocketClientManager->IsConnected();
+}
 
 #else
 #if defined(__GNUC__) || defined(__clang__)
@@ -364,12 +390,19 @@ bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() {
 #endif
 Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
     : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
-      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
+      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckGeneration(0),
+      m_healthCheckInFlight(std::make_shared<std::atomic<bool>>(false)),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
       m_terminateProcessCallback(new TerminateProcessCallback(this)), m_updateGameSessionCallback(new UpdateGameSessionCallback(this)),
       m_startMatchBackfillCallback(new StartMatchBackfillCallback()), m_refreshConnectionCallback(new RefreshConnectionCallback(this)),
-      m_globalProcessor(nullptr) {}
+      m_callbackExecutor(nullptr), m_callbackExecutorState(nullptr), m_globalProcessor(nullptr), m_taskScheduler(new TaskScheduler()),
+      m_asyncReconnectInProgress(false) {
+    m_webSocketClientWrapperFactory = [] {
+        std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
+        return std::shared_ptr<IWebSocketClientWrapper>(std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer));
+    };
+}
 
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
@@ -377,16 +410,19 @@ Aws::GameLift::Internal::GameLiftServerState::GameLiftServerState()
 
 Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
+    // Stop heartbeats and asynchronous requests. Any requests that are still pending complete with an error.
+    m_taskScheduler->Shutdown();
+    // A reconnect still running uses the websocket members below. Its completion is dropped by the
+    // scheduler, which fails the request that started it.
+    if (m_asyncReconnectThread.joinable()) {
+        m_asyncReconnectThread.join();
+    }
+    // Callbacks that are already running finish on their own, this doesn't wait for them.
+    if (m_callbackThreadPool) {
+        m_callbackThreadPool->Shutdown();
+    }
+    if (m_lifecycleCallbackThreadPool) {
+        m_lifecycleCallbackThreadPool->Shutdown();
     }
 
     Aws::GameLift::Internal::GameLiftCommonState::SetInstance(nullptr);
@@ -402,7 +438,6 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
     // Tell the webSocketClientManager to disconnect and delete the websocket
     if (m_webSocketClientManager) {
         m_webSocketClientManager->Disconnect();
-        delete m_webSocketClientManager;
         m_webSocketClientManager = nullptr;
     }
 
@@ -410,7 +445,15 @@ Aws::GameLift::Internal::GameLiftServerState::~GameLiftServerState() {
 }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
-    spdlog::info("Calling ProcessReady");
+    SPDLOG_INFO("Calling ProcessReady");
+
+    // Set up where callbacks run before setting the callbacks, so there is always somewhere to dispatch them.
+    m_callbackExecutor = processParameters.getCallbackExecutor();
+    m_callbackExecutorState = processParameters.getCallbackExecutorState();
+    if (!m_callbackExecutor && !m_callbackThreadPool) {
+        m_callbackThreadPool = std::unique_ptr<ThreadPool>(new ThreadPool(CALLBACK_THREAD_POOL_SIZE));
+        m_lifecycleCallbackThreadPool = std::unique_ptr<ThreadPool>(new ThreadPool(1));
+    }
 
     m_onStartGameSession = processParameters.getOnStartGameSession();
     m_startGameSessionState = processParameters.getStartGameSessionState();
@@ -445,44 +488,57 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessReady(const
     GenericOutcome result = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 
     if (result.IsSuccess()) {
-        spdlog::info("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting m_healthCheckThread().");
+        SPDLOG_INFO("Successfully executed ActivateServerProcess. Marked m_processReady as true and starting health checks.");
         m_processReady = true;
-        m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
+        StartHealthCheck();
     } else {
-        spdlog::info("Error while executing ActivateServerProcess. See the root cause error for more information.");
+        SPDLOG_INFO("Error while executing ActivateServerProcess. See the root cause error for more information.");
     }
 
     return result;
 }
 
 void Aws::GameLift::Internal::GameLiftServerState::ReportHealth() {
-    spdlog::info("Calling ReportHealth");
-    std::future<bool> future(std::async([]() { return true; }));
-    if (m_onHealthCheck) {
-        future = std::async(std::launch::async, m_onHealthCheck, m_healthCheckState);
+    SPDLOG_INFO("Calling ReportHealth");
+    std::shared_ptr<bool> healthReported = std::make_shared<bool>(false);
+    if (!m_onHealthCheck) {
+        ReportHealthStatus(healthReported, true);
+        return;
     }
 
-    std::chrono::system_clock::time_point timeoutSeconds = std::chrono::system_clock::now() + std::chrono::milliseconds(HEALTHCHECK_TIMEOUT_MILLIS);
-    bool health = false;
-
-    // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-        spdlog::info("Received Health Response: {} from Server Process: {}", health, m_processId);
-    } else {
-        spdlog::warn("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+    // Don't pile up calls behind a health check that is still running, report unhealthy for this beat instead.
+    if (m_healthCheckInFlight->exchange(true)) {
+        SPDLOG_WARN("Previous health check for server process {} is still running. Reporting as unhealthy.", m_processId);
+        ReportHealthStatus(healthReported, false);
+        return;
     }
 
-    Aws::GameLift::Internal::HeartbeatServerProcessRequest msg = Aws::GameLift::Internal::HeartbeatServerProcessRequest().WithHealthy(health);
-    if (m_webSocketClientManager || m_webSocketClientWrapper) {
-        spdlog::info("Trying to report process health as {} for process {}", health, m_processId);
-        auto outcome = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(msg);
-        if (!outcome.IsSuccess()) {
-            spdlog::error("Error reporting process health for process {}.", m_processId);
+    // Report unhealthy if the developer callback doesn't answer in time
+    m_taskScheduler->PostAfter(HEALTHCHECK_TIMEOUT_MILLIS, [this, healthReported] {
+        if (!*healthReported) {
+            SPDLOG_WARN("Timed out waiting for health response from the server process {}. Reporting as unhealthy.", m_processId);
+            ReportHealthStatus(healthReported, false);
         }
-    } else {
-        spdlog::error("Tried to report process health for process {} with no active connection", m_processId);
-    }
+    });
+
+    std::function<bool(void *)> onHealthCheck = m_onHealthCheck;
+    void *healthCheckState = m_healthCheckState;
+    std::shared_ptr<TaskScheduler> taskScheduler = m_taskScheduler;
+    std::shared_ptr<std::atomic<bool>> healthCheckInFlight = m_healthCheckInFlight;
+    DispatchCallback(m_callbackThreadPool.get(), "OnHealthCheck", [this, onHealthCheck, healthCheckState, taskScheduler, healthCheckInFlight, healthReported] {
+        bool health = false;
+        try {
+            health = onHealthCheck(healthCheckState);
+        } catch (const std::exception &e) {
+            SPDLOG_ERROR("Exception thrown by health check callback: {}", e.what());
+        } catch (...) {
+            SPDLOG_ERROR("Unknown exception thrown by health check callback");
+        }
+        *healthCheckInFlight = false;
+        // Hop back onto the task scheduler. If the SDK was destroyed in the meantime the scheduler
+        // has shut down and drops the task, so "this" is never touched.
+        taskScheduler->Post([this, healthReported, health] { ReportHealthStatus(healthReported, health); });
+    });
 }
 
 ::GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ProcessEnding() {
@@ -576,7 +632,9 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSession
     return Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
 }
 
-std::shared_ptr<Aws::GameLift::Internal::IWebSocketClientWrapper> Aws::GameLift::Internal::GameLiftServerState::GetWebSocketClientWrapper() const { return m_webSocketClientWrapper; }
+std::shared_ptr<Aws::GameLift::Internal::IWebSocketClientWrapper> Aws::GameLift::Internal::GameLiftServerState::GetWebSocketClientWrapper() const {
+    return GetCurrentWebSocketClientWrapper();
+}
 
 Aws::GameLift::Internal::InitSDKOutcome Aws::GameLift::Internal::GameLiftServerState::ConstructInternal(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper) {
     if (GameLiftCommonState::GetInstance().IsSuccess()) {
@@ -609,13 +667,12 @@ void Aws::GameLift::Internal::GameLiftServerState::OnStartGameSession(Aws::GameL
     // Call metrics OnGameSessionStarted
     if (!gameSessionId.empty() && m_globalProcessor != nullptr) {
         Aws::GameLift::Metrics::OnGameSessionStarted(gameSession);
-        spdlog::info("Tagged metrics with game session: {}", gameSessionId);
+        SPDLOG_INFO("Tagged metrics with game session: {}", gameSessionId);
     }
 
     // Invoking OnStartGameSession callback if specified by the developer.
     if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession, m_startGameSessionState));
-        activateGameSession.detach();
+        DispatchCallback(m_lifecycleCallbackThreadPool.get(), "OnStartGameSession", std::bind(m_onStartGameSession, gameSession, m_startGameSessionState));
     }
 }
 
@@ -626,8 +683,7 @@ void Aws::GameLift::Internal::GameLiftServerState::OnUpdateGameSession(Aws::Game
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
     if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession, m_updateGameSessionState));
-        updateGameSessionThread.detach();
+        DispatchCallback(m_lifecycleCallbackThreadPool.get(), "OnUpdateGameSession", std::bind(m_onUpdateGameSession, updateGameSession, m_updateGameSessionState));
     }
 }
 
@@ -641,10 +697,9 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
 
     // Invoking onProcessTerminate callback if specified by the developer.
     if (m_onProcessTerminate) {
-        std::thread terminateProcess(std::bind(m_onProcessTerminate, m_processTerminateState));
-        terminateProcess.detach();
+        DispatchCallback(m_lifecycleCallbackThreadPool.get(), "OnProcessTerminate", std::bind(m_onProcessTerminate, m_processTerminateState));
     } else {
-        spdlog::info("OnProcessTerminate handler is not defined. Calling ProcessEnding() and Destroy()");
+        SPDLOG_INFO("OnProcessTerminate handler is not defined. Calling ProcessEnding() and Destroy()");
         GenericOutcome processEndingResult = ProcessEnding();
         GenericOutcome destroyResult = DestroyInstance();
         if (processEndingResult.IsSuccess() && destroyResult.IsSuccess()) {
@@ -652,10 +707,10 @@ void Aws::GameLift::Internal::GameLiftServerState::OnTerminateProcess(long termi
         }
         else {
             if (!processEndingResult.IsSuccess()) {
-                spdlog::error("Failed to call ProcessEnding().");
+                SPDLOG_ERROR("Failed to call ProcessEnding().");
             }
             if (!destroyResult.IsSuccess()) {
-                spdlog::error("Failed to call Destroy().");
+                SPDLOG_ERROR("Failed to call Destroy().");
             }
             exit(-1);
         }
@@ -668,15 +723,18 @@ void Aws::GameLift::Internal::GameLiftServerState::OnRefreshConnection(const std
     }
     m_connectionEndpoint = refreshConnectionEndpoint;
     m_authToken = authToken;
-    spdlog::info("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
-    m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    SPDLOG_INFO("Refreshing Connection to ConnectionEndpoint: {} for process {}...", m_connectionEndpoint, m_processId);
+    GetWebSocketClientManager()->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
 }
 
-bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
+bool Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized() {
+    std::shared_ptr<GameLiftWebSocketClientManager> webSocketClientManager = GetWebSocketClientManager();
+    return !webSocketClientManager || !webSocketClientManager->IsConnected();
+}
 #endif
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworking(const Aws::GameLift::Server::Model::ServerParameters &serverParameters) {
-    spdlog::info("Initializing Networking");
+    SPDLOG_INFO("Initializing Networking");
 
     Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks();
 
@@ -775,7 +833,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
             ContainerCredentialsFetcher containerCredentialsFetcher = ContainerCredentialsFetcher(httpClient);
             Outcome<AwsCredentials, std::string> containerCredentialsFetcherOutcome = containerCredentialsFetcher.FetchContainerCredentials();
             if(!containerCredentialsFetcherOutcome.IsSuccess()) {
-                spdlog::error("Failed to get Container Credentials due to {}",
+                SPDLOG_ERROR("Failed to get Container Credentials due to {}",
                               containerCredentialsFetcherOutcome.GetError().c_str());
                 return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
             }
@@ -791,7 +849,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
             ContainerMetadataFetcher containerMetadataFetcher = ContainerMetadataFetcher(httpClient);
             Outcome<ContainerTaskMetadata, std::string> containerMetadataFetcherOutcome = containerMetadataFetcher.FetchContainerTaskMetadata();
             if(!containerMetadataFetcherOutcome.IsSuccess()) {
-                spdlog::error("Failed to get Container Task Metadata due to {}",
+                SPDLOG_ERROR("Failed to get Container Task Metadata due to {}",
                               containerMetadataFetcherOutcome.GetError().c_str());
                 return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
             }
@@ -799,7 +857,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
         }
         Outcome<std::map<std::string, std::string>, std::string> sigV4QueryParametersOutcome = GetSigV4QueryParameters(awsRegion, accessKey, secretKey, sessionToken);
         if (!sigV4QueryParametersOutcome.IsSuccess()) {
-            spdlog::error("Failed to generate SigV4 Query Parameters due to {}",
+            SPDLOG_ERROR("Failed to generate SigV4 Query Parameters due to {}",
                           sigV4QueryParametersOutcome.GetError().c_str());
             return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
         }
@@ -817,72 +875,58 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::InitializeNetworkin
 
 void Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks() {
     // Setup
-    m_webSocketClientManager = new Aws::GameLift::Internal::GameLiftWebSocketClientManager(m_webSocketClientWrapper);
+    m_webSocketClientManager = std::make_shared<Aws::GameLift::Internal::GameLiftWebSocketClientManager>(m_webSocketClientWrapper);
 
     // Setup CreateGameSession callback
-    spdlog::info("Setting Up WebSocket With default callbacks");
-    // Passing callback raw pointers down is fine since m_webSocketClientWrapper won't outlive the
-    // callbacks
+    SPDLOG_INFO("Setting Up WebSocket With default callbacks");
+    // Capturing this is fine since m_webSocketClientWrapper won't outlive the callbacks, which are
+    // owned by this state
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         CreateGameSessionCallback::CREATE_GAME_SESSION,
-        std::bind(&CreateGameSessionCallback::OnStartGameSession, m_createGameSessionCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_createGameSessionCallback->OnStartGameSession(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         DescribePlayerSessionsCallback::DESCRIBE_PLAYER_SESSIONS,
-        std::bind(&DescribePlayerSessionsCallback::OnDescribePlayerSessions, m_describePlayerSessionsCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_describePlayerSessionsCallback->OnDescribePlayerSessions(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         GetComputeCertificateCallback::GET_COMPUTE_CERTIFICATE,
-        std::bind(&GetComputeCertificateCallback::OnGetComputeCertificateCallback, m_getComputeCertificateCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_getComputeCertificateCallback->OnGetComputeCertificateCallback(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         GetFleetRoleCredentialsCallback::GET_FLEET_ROLE_CREDENTIALS,
-        std::bind(&GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials, m_getFleetRoleCredentialsCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_getFleetRoleCredentialsCallback->OnGetFleetRoleCredentials(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         TerminateProcessCallback::TERMINATE_PROCESS,
-        std::bind(&TerminateProcessCallback::OnTerminateProcess, m_terminateProcessCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_terminateProcessCallback->OnTerminateProcess(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         UpdateGameSessionCallback::UPDATE_GAME_SESSION,
-        std::bind(&UpdateGameSessionCallback::OnUpdateGameSession, m_updateGameSessionCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_updateGameSessionCallback->OnUpdateGameSession(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         StartMatchBackfillCallback::START_MATCH_BACKFILL,
-        std::bind(&StartMatchBackfillCallback::OnStartMatchBackfill, m_startMatchBackfillCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_startMatchBackfillCallback->OnStartMatchBackfill(data); });
     m_webSocketClientWrapper->RegisterGameLiftCallback(
         RefreshConnectionCallback::REFRESH_CONNECTION,
-        std::bind(&RefreshConnectionCallback::OnRefreshConnection, m_refreshConnectionCallback.get(), std::placeholders::_1));
+        [this](const rapidjson::Value &data) { return m_refreshConnectionCallback->OnRefreshConnection(data); });
 }
 
 GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(Message &message) {
-    spdlog::debug("Trying to send socket message for process: {}...", m_processId);
+    SPDLOG_DEBUG("Trying to send socket message for process: {}...", m_processId);
     GenericOutcome outcome;
     int resendFailureCount = 0;
-    const int maxFailuresBeforeReconnect = 2;
 
     // Delegate to the websocketClientManager to send the request and retry if possible
     const std::function<bool(void)> &retriable = [&] {
-        outcome = m_webSocketClientManager->SendSocketMessage(message);
+        std::shared_ptr<GameLiftWebSocketClientManager> webSocketClientManager = GetWebSocketClientManager();
+        outcome = webSocketClientManager->SendSocketMessage(message);
         if (outcome.IsSuccess()) {
-            spdlog::debug("Successfully send message for process: {}", m_processId);
+            SPDLOG_DEBUG("Successfully send message for process: {}", m_processId);
             return true;
         }
         else if (outcome.GetError().GetErrorType() == GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE) {
             resendFailureCount++;
-            if (resendFailureCount >= maxFailuresBeforeReconnect) {
-                spdlog::warn("Max sending message failure threshold reached for process: {}. Attempting to reconnect...", m_processId);
-                m_webSocketClientWrapper->Disconnect();
-
-                spdlog::info("Attempting to create a new WebSocket connections for process: {}...", m_processId);
-                // Create a completely new webSocketClientWrapper
-                std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
-                m_webSocketClientWrapper = std::make_shared<Internal::WebSocketppClientWrapper>(wsClientPointer);
-
-                spdlog::info("Re-establish Networking...");
-                // Re-establish network with new webSocketClientWrapper
-                Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks();
-                auto networkOutcome = m_webSocketClientManager->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
-                if (networkOutcome.IsSuccess()) {
-                    spdlog::info("Reconnected successfully. Retrying message sending...");
+            if (resendFailureCount >= MAX_FAILURES_BEFORE_RECONNECT) {
+                if (ReconnectWebSocket(webSocketClientManager)) {
                     resendFailureCount = 0;
                     return false; // Force another retry sending message after successful connection
                 } else {
-                    spdlog::error("Reconnection failed. Aborting retries.");
                     return true; // Abort retry if connection fails
                 }
             }
@@ -901,13 +945,93 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWi
     callable.call();
 
     if (resendFailureCount > 0 && !outcome.IsSuccess()) {
-        spdlog::error("Error sending socket message");
+        SPDLOG_ERROR("Error sending socket message");
         outcome = GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
     }
 
     return outcome;
 }
 
+std::shared_ptr<Aws::GameLift::Internal::GameLiftWebSocketClientManager> Aws::GameLift::Internal::GameLiftServerState::GetWebSocketClientManager() const {
+    std::lock_guard<std::mutex> lock(m_webSocketMutex);
+    return m_webSocketClientManager;
+}
+
+std::shared_ptr<Aws::GameLift::Internal::IWebSocketClientWrapper> Aws::GameLift::Internal::GameLiftServerState::GetCurrentWebSocketClientWrapper() const {
+    std::lock_guard<std::mutex> lock(m_webSocketMutex);
+    return m_webSocketClientWrapper;
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::SetWebSocketClientWrapperFactory(
+    const std::function<std::shared_ptr<IWebSocketClientWrapper>()> &webSocketClientWrapperFactory) {
+    std::lock_guard<std::mutex> reconnectLock(m_reconnectMutex);
+    m_webSocketClientWrapperFactory = webSocketClientWrapperFactory;
+}
+
+bool Aws::GameLift::Internal::GameLiftServerState::ReconnectWebSocket(const std::shared_ptr<GameLiftWebSocketClientManager> &failedManager) {
+    std::lock_guard<std::mutex> reconnectLock(m_reconnectMutex);
+    std::shared_ptr<GameLiftWebSocketClientManager> replacedManager = GetWebSocketClientManager();
+    if (failedManager != replacedManager) {
+        SPDLOG_INFO("WebSocket for process: {} was already reconnected. Retrying message sending...", m_processId);
+        return true;
+    }
+
+    SPDLOG_WARN("Max sending message failure threshold reached for process: {}. Attempting to reconnect...", m_processId);
+    // Disconnecting fails the requests still waiting for a response on the old connection, so they
+    // retry on the new one instead of waiting for their timeout.
+    replacedManager->Disconnect();
+
+    SPDLOG_INFO("Attempting to create a new WebSocket connections for process: {}...", m_processId);
+    // Create a completely new webSocketClientWrapper
+    std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper = m_webSocketClientWrapperFactory();
+
+    SPDLOG_INFO("Re-establish Networking...");
+    // Re-establish network with new webSocketClientWrapper. Senders on other threads see either the old
+    // manager and wrapper or both new ones. The old ones are released once the last sender drops them,
+    // outside the lock, since destroying a wrapper joins its socket threads.
+    std::shared_ptr<IWebSocketClientWrapper> replacedWrapper;
+    {
+        std::lock_guard<std::mutex> lock(m_webSocketMutex);
+        replacedWrapper = m_webSocketClientWrapper;
+        m_webSocketClientWrapper = webSocketClientWrapper;
+        Aws::GameLift::Internal::GameLiftServerState::SetUpCallbacks();
+    }
+    auto networkOutcome = GetWebSocketClientManager()->Connect(m_connectionEndpoint, m_authToken, m_processId, m_hostId, m_fleetId);
+    if (networkOutcome.IsSuccess()) {
+        SPDLOG_INFO("Reconnected successfully. Retrying message sending...");
+        return true;
+    } else {
+        SPDLOG_ERROR("Reconnection failed. Aborting retries.");
+        return false;
+    }
+}
+
+#ifndef GAMELIFT_USE_STD
+namespace {
+// Adapts a callback task to the plain function pointer handed to a developer-provided executor.
+void RunCallbackTask(void *taskState) {
+    std::unique_ptr<std::function<void()>> task(static_cast<std::function<void()> *>(taskState));
+    (*task)();
+}
+} // namespace
+#endif
+
+void Aws::GameLift::Internal::GameLiftServerState::DispatchCallback(ThreadPool *threadPool, const char *callbackName, const std::function<void()> &callback) {
+    if (m_callbackExecutor) {
+#ifdef GAMELIFT_USE_STD
+        m_callbackExecutor(callback);
+#else
+        m_callbackExecutor(&RunCallbackTask, new std::function<void()>(callback), m_callbackExecutorState);
+#endif
+    } else if (threadPool) {
+        threadPool->Post(callback, callbackName);
+    } else {
+        // Callbacks are only set by ProcessReady(), after it has set up an executor or the thread pools.
+        SPDLOG_WARN("No callback executor available, running {} callback on the task scheduler", callbackName);
+        m_taskScheduler->Post(callback);
+    }
+}
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdelete-non-abstract-non-virtual-dtor"
@@ -921,6 +1045,10 @@ Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessions(const Aws::
 
     Aws::GameLift::Internal::WebSocketDescribePlayerSessionsRequest request = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest);
     GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
+    return ToDescribePlayerSessionsOutcome(rawResponse);
+}
+
+DescribePlayerSessionsOutcome Aws::GameLift::Internal::GameLiftServerState::ToDescribePlayerSessionsOutcome(const GenericOutcome &rawResponse) {
     if (rawResponse.IsSuccess()) {
         WebSocketDescribePlayerSessionsResponse *webSocketResponse = static_cast<WebSocketDescribePlayerSessionsResponse *>(rawResponse.GetResult());
         DescribePlayerSessionsResult result = Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(webSocketResponse);
@@ -934,24 +1062,38 @@ Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessions(const Aws::
 
 StartMatchBackfillOutcome
 Aws::GameLift::Internal::GameLiftServerState::StartMatchBackfill(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest) {
+    GenericOutcome validationOutcome = ValidateStartMatchBackfillRequest(startMatchBackfillRequest);
+    if (!validationOutcome.IsSuccess()) {
+        return StartMatchBackfillOutcome(validationOutcome.GetError());
+    }
+
+    Aws::GameLift::Internal::WebSocketStartMatchBackfillRequest request = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest);
+    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
+    return ToStartMatchBackfillOutcome(rawResponse);
+}
+
+GenericOutcome
+Aws::GameLift::Internal::GameLiftServerState::ValidateStartMatchBackfillRequest(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest) {
     if (Aws::GameLift::Internal::GameLiftServerState::AssertNetworkInitialized()) {
-        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
 #ifdef GAMELIFT_USE_STD
     if (startMatchBackfillRequest.GetPlayers().empty()) {
-        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty."));
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty."));
     }
 #else
     int countOfPlayers;
     startMatchBackfillRequest.GetPlayers(countOfPlayers);
     if (countOfPlayers == 0) {
-        return StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty."));
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Players cannot be empty."));
     }
 #endif
 
-    Aws::GameLift::Internal::WebSocketStartMatchBackfillRequest request = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest);
-    GenericOutcome rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
+    return GenericOutcome(nullptr);
+}
+
+StartMatchBackfillOutcome Aws::GameLift::Internal::GameLiftServerState::ToStartMatchBackfillOutcome(const GenericOutcome &rawResponse) {
     if (rawResponse.IsSuccess()) {
         WebSocketStartMatchBackfillResponse *webSocketResponse = static_cast<WebSocketStartMatchBackfillResponse *>(rawResponse.GetResult());
         StartMatchBackfillResult result = Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(webSocketResponse);
@@ -974,7 +1116,7 @@ GenericOutcome Aws::GameLift::Internal::GameLiftServerState::StopMatchBackfill(c
                                                               .WithMatchmakingConfigurationArn(stopMatchBackfillRequest.GetMatchmakingConfigurationArn());
     GenericOutcome outcome = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(request);
     if (!outcome.IsSuccess()) {
-        spdlog::error("Error calling StopMatchBackfill.");
+        SPDLOG_ERROR("Error calling StopMatchBackfill.");
     }
     return outcome;
 }
@@ -1009,18 +1151,31 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
         return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
+    auto webSocketRequest = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(request);
+    GetFleetRoleCredentialsOutcome localOutcome;
+    if (ResolveFleetRoleCredentialsLocally(webSocketRequest, localOutcome)) {
+        return localOutcome;
+    }
+
+    auto rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(webSocketRequest);
+    return ToGetFleetRoleCredentialsOutcome(webSocketRequest.GetRoleArn(), rawResponse);
+}
+
+bool Aws::GameLift::Internal::GameLiftServerState::ResolveFleetRoleCredentialsLocally(WebSocketGetFleetRoleCredentialsRequest &webSocketRequest,
+                                                                                     GetFleetRoleCredentialsOutcome &outcome) {
+    std::lock_guard<std::mutex> lock(m_instanceRoleMutex);
     // If we've decided we're not on managed EC2 or managed containers, fail without making an APIGW call
     if (!m_onManagedEC2OrContainers) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION, 
+        outcome = GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION, 
             "Fleet role credentials not available for Anywhere fleet."));
+        return true;
     }
 
-    auto webSocketRequest = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(request);
-
     // Check if we're cached credentials recently that still has at least 15 minutes before
     // expiration
-    if (m_instanceRoleResultCache.find(webSocketRequest.GetRoleArn()) != m_instanceRoleResultCache.end()) {
-        auto previousResult = m_instanceRoleResultCache[webSocketRequest.GetRoleArn()];
+    auto cachedResult = m_instanceRoleResultCache.find(webSocketRequest.GetRoleArn());
+    if (cachedResult != m_instanceRoleResultCache.end()) {
+        const GetFleetRoleCredentialsResult &previousResult = cachedResult->second;
 #ifdef GAMELIFT_USE_STD
         std::tm expiration = previousResult.GetExpiration();
 #ifdef WIN32
@@ -1034,10 +1189,11 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
         time_t currentTime = time(nullptr);
 
         if ((previousResultExpiration - INSTANCE_ROLE_CREDENTIAL_TTL_MIN) > currentTime) {
-            return GetFleetRoleCredentialsOutcome(previousResult);
+            outcome = GetFleetRoleCredentialsOutcome(previousResult);
+            return true;
         }
 
-        m_instanceRoleResultCache.erase(webSocketRequest.GetRoleArn());
+        m_instanceRoleResultCache.erase(cachedResult);
     }
 
     if (webSocketRequest.GetRoleSessionName().empty()) {
@@ -1049,11 +1205,16 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
     }
 
     if (webSocketRequest.GetRoleSessionName().length() > MAX_ROLE_SESSION_NAME_LENGTH) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
+        outcome = GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
             "GetFleetRoleCredentials failed; the role session name is too long. Please check role arn or session name and try again."));
+        return true;
     }
 
-    auto rawResponse = Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetries(webSocketRequest);
+    return false;
+}
+
+GetFleetRoleCredentialsOutcome Aws::GameLift::Internal::GameLiftServerState::ToGetFleetRoleCredentialsOutcome(const std::string &roleArn,
+                                                                                                              const GenericOutcome &rawResponse) {
     if (!rawResponse.IsSuccess()) {
         return GetFleetRoleCredentialsOutcome(rawResponse.GetError());
     }
@@ -1063,16 +1224,245 @@ Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws:
 
     // If we get a success response from APIGW with empty fields we're not on managed EC2 or managed containers.
     if (webSocketResponse->GetAccessKeyId().empty()) {
+        std::lock_guard<std::mutex> lock(m_instanceRoleMutex);
         m_onManagedEC2OrContainers = false;
         return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION,
             "Fleet role credentials not available for Anywhere fleet."));
     }
 
     auto result = Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(webSocketResponse.get());
-    m_instanceRoleResultCache[webSocketRequest.GetRoleArn()] = result;
+    {
+        std::lock_guard<std::mutex> lock(m_instanceRoleMutex);
+        m_instanceRoleResultCache[roleArn] = result;
+    }
     return GetFleetRoleCredentialsOutcome(result);
 }
 
+// State for one request sent through SendSocketMessageWithRetriesAsync. It is shared by the
+// scheduled attempts and response handlers, and lives until the last of them is gone.
+struct Aws::GameLift::Internal::GameLiftServerState::AsyncSendOperation {
+    AsyncSendOperation(const std::shared_ptr<Message> &message, const std::function<void(const GenericOutcome &)> &onComplete)
+        : message(message), onComplete(onComplete), resendFailureCount(0), waitForReconnectCount(0) {}
+
+    // An operation can be dropped before it completes, e.g. when the SDK is destroyed while a retry
+    // is pending. Still report back so callers never wait on a result that won't come.
+    ~AsyncSendOperation() {
+        if (onComplete) {
+            Complete(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        }
+    }
+
+    void Complete(const GenericOutcome &outcome) {
+        std::function<void(const GenericOutcome &)> callback;
+        callback.swap(onComplete);
+        callback(outcome);
+    }
+
+    std::shared_ptr<Message> message;
+    std::function<void(const GenericOutcome &)> onComplete;
+    GenericOutcome lastOutcome;
+    int resendFailureCount;
+    int waitForReconnectCount;
+    // Manager the last attempt was sent through, to tell whether the connection was replaced since.
+    std::weak_ptr<GameLiftWebSocketClientManager> webSocketClientManager;
+};
+
+void Aws::GameLift::Internal::GameLiftServerState::SendSocketMessageWithRetriesAsync(const std::shared_ptr<Message> &message,
+                                                                                     const std::function<void(const GenericOutcome &)> &onComplete) {
+    SPDLOG_DEBUG("Trying to send socket message asynchronously for process: {}...", m_processId);
+    std::shared_ptr<AsyncSendOperation> operation = std::make_shared<AsyncSendOperation>(message, onComplete);
+
+    // Same jittered backoff as SendSocketMessageWithRetries, but the delays are timers on the task
+    // scheduler. All attempts and completions run on the scheduler thread, so the retry state is
+    // never shared between threads.
+    AsyncRetryingCallable::Builder()
+        .WithRetryStrategy(&m_asyncRetryStrategy)
+        .WithTaskScheduler(m_taskScheduler.get())
+        .WithCallable([this, operation](const AsyncRetryingCallable::AttemptCallback &done) { AttemptAsyncSend(operation, done); })
+        .WithOnComplete([operation](bool) {
+            if (operation->resendFailureCount > 0 && !operation->lastOutcome.IsSuccess()) {
+                SPDLOG_ERROR("Error sending socket message");
+                operation->Complete(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+            } else {
+                operation->Complete(operation->lastOutcome);
+            }
+        })
+        .Build()
+        .call();
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::AttemptAsyncSend(const std::shared_ptr<AsyncSendOperation> &operation,
+                                                                    const AsyncRetryingCallable::AttemptCallback &done) {
+    std::shared_ptr<GameLiftWebSocketClientManager> webSocketClientManager = GetWebSocketClientManager();
+    if (!webSocketClientManager) {
+        operation->lastOutcome = GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        done(true);
+        return;
+    }
+
+    // Like the synchronous send, give an in-progress reconnect time to finish before sending, but
+    // check back on a timer instead of sleeping. This doesn't count as a failed attempt.
+    if (!webSocketClientManager->IsConnected()) {
+        if (++operation->waitForReconnectCount < WAIT_FOR_RECONNECT_MAX_RETRIES) {
+            SPDLOG_WARN("WebSocket is not connected... retrying send in {} ms", WAIT_FOR_RECONNECT_RETRY_DELAY_MILLIS);
+            m_taskScheduler->PostAfter(WAIT_FOR_RECONNECT_RETRY_DELAY_MILLIS, [this, operation, done] { AttemptAsyncSend(operation, done); });
+            return;
+        }
+        SPDLOG_WARN("WebSocket is not connected... WebSocket failed to send message due to an error.");
+        OnAsyncSendAttemptComplete(operation, GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)), done);
+        return;
+    }
+    operation->waitForReconnectCount = 0;
+    operation->webSocketClientManager = webSocketClientManager;
+
+    // Responses arrive on the websocket threads, hop back onto the task scheduler to handle them. Hold
+    // on to the scheduler, a late response may arrive after the SDK was destroyed and is then dropped.
+    std::shared_ptr<TaskScheduler> taskScheduler = m_taskScheduler;
+    webSocketClientManager->SendSocketMessageAsync(*operation->message, [this, taskScheduler, operation, done](const GenericOutcome &outcome) {
+        taskScheduler->Post([this, operation, done, outcome] { OnAsyncSendAttemptComplete(operation, outcome, done); });
+    });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::OnAsyncSendAttemptComplete(const std::shared_ptr<AsyncSendOperation> &operation,
+                                                                              const GenericOutcome &outcome,
+                                                                              const AsyncRetryingCallable::AttemptCallback &done) {
+    operation->lastOutcome = outcome;
+    if (outcome.IsSuccess()) {
+        SPDLOG_DEBUG("Successfully send message for process: {}", m_processId);
+        done(true);
+        return;
+    }
+
+    // Mirrors the retry rules of SendSocketMessageWithRetries
+    if (outcome.GetError().GetErrorType() != GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE) {
+        done(true);
+        return;
+    }
+    operation->resendFailureCount++;
+    if (operation->resendFailureCount < MAX_FAILURES_BEFORE_RECONNECT) {
+        done(false);
+        return;
+    }
+    operation->resendFailureCount = 0;
+
+    // Another request already started a reconnect, or finished one since this attempt was sent. Retry,
+    // the next attempt waits for the connection.
+    std::shared_ptr<GameLiftWebSocketClientManager> failedManager = operation->webSocketClientManager.lock();
+    if (m_asyncReconnectInProgress || !failedManager || failedManager != GetWebSocketClientManager()) {
+        done(false);
+        return;
+    }
+
+    // Reconnecting blocks until the new connection is up, so it runs on its own thread to keep
+    // heartbeats and other completions going. The retry resumes on the scheduler afterwards.
+    m_asyncReconnectInProgress = true;
+    if (m_asyncReconnectThread.joinable()) {
+        // Only the scheduler starts reconnects, and the previous one has already posted its completion.
+        m_asyncReconnectThread.join();
+    }
+    m_asyncReconnectThread = std::thread([this, failedManager, operation, done] {
+        bool reconnected = ReconnectWebSocket(failedManager);
+        m_taskScheduler->Post([this, operation, done, reconnected] {
+            m_asyncReconnectInProgress = false;
+            done(!reconnected);
+        });
+    });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::AcceptPlayerSessionAsync(const std::string &playerSessionId,
+                                                                            const std::function<void(const GenericOutcome &)> &onComplete) {
+    GenericOutcome validationOutcome = ValidatePlayerSessionRequest(playerSessionId);
+    if (!validationOutcome.IsSuccess()) {
+        m_taskScheduler->Post([onComplete, validationOutcome] { onComplete(validationOutcome); });
+        return;
+    }
+
+    std::shared_ptr<Message> request =
+        std::make_shared<AcceptPlayerSessionRequest>(AcceptPlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId));
+    SendSocketMessageWithRetriesAsync(request, onComplete);
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::RemovePlayerSessionAsync(const std::string &playerSessionId,
+                                                                            const std::function<void(const GenericOutcome &)> &onComplete) {
+    GenericOutcome validationOutcome = ValidatePlayerSessionRequest(playerSessionId);
+    if (!validationOutcome.IsSuccess()) {
+        m_taskScheduler->Post([onComplete, validationOutcome] { onComplete(validationOutcome); });
+        return;
+    }
+
+    std::shared_ptr<Message> request =
+        std::make_shared<RemovePlayerSessionRequest>(RemovePlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId));
+    SendSocketMessageWithRetriesAsync(request, onComplete);
+}
+
+GenericOutcome Aws::GameLift::Internal::GameLiftServerState::ValidatePlayerSessionRequest(const std::string &playerSessionId) {
+    if (AssertNetworkInitialized()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+    }
+
+    if (m_gameSessionId.empty()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET));
+    }
+
+    if (playerSessionId.empty()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::VALIDATION_EXCEPTION, "Player session id is empty."));
+    }
+
+    return GenericOutcome(nullptr);
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::DescribePlayerSessionsAsync(
+    const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+    const std::function<void(const DescribePlayerSessionsOutcome &)> &onComplete) {
+    if (AssertNetworkInitialized()) {
+        DescribePlayerSessionsOutcome errorOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        m_taskScheduler->Post([onComplete, errorOutcome] { onComplete(errorOutcome); });
+        return;
+    }
+
+    std::shared_ptr<Message> request =
+        std::make_shared<WebSocketDescribePlayerSessionsRequest>(Aws::GameLift::Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest));
+    SendSocketMessageWithRetriesAsync(request, [onComplete](const GenericOutcome &rawResponse) { onComplete(ToDescribePlayerSessionsOutcome(rawResponse)); });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::StartMatchBackfillAsync(
+    const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+    const std::function<void(const StartMatchBackfillOutcome &)> &onComplete) {
+    GenericOutcome validationOutcome = ValidateStartMatchBackfillRequest(startMatchBackfillRequest);
+    if (!validationOutcome.IsSuccess()) {
+        StartMatchBackfillOutcome errorOutcome(validationOutcome.GetError());
+        m_taskScheduler->Post([onComplete, errorOutcome] { onComplete(errorOutcome); });
+        return;
+    }
+
+    std::shared_ptr<Message> request =
+        std::make_shared<WebSocketStartMatchBackfillRequest>(Aws::GameLift::Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest));
+    SendSocketMessageWithRetriesAsync(request, [onComplete](const GenericOutcome &rawResponse) { onComplete(ToStartMatchBackfillOutcome(rawResponse)); });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::GetFleetRoleCredentialsAsync(
+    const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+    const std::function<void(const GetFleetRoleCredentialsOutcome &)> &onComplete) {
+    if (AssertNetworkInitialized()) {
+        GetFleetRoleCredentialsOutcome errorOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
+        m_taskScheduler->Post([onComplete, errorOutcome] { onComplete(errorOutcome); });
+        return;
+    }
+
+    std::shared_ptr<WebSocketGetFleetRoleCredentialsRequest> webSocketRequest =
+        std::make_shared<WebSocketGetFleetRoleCredentialsRequest>(Aws::GameLift::Internal::GetFleetRoleCredentialsAdapter::convert(request));
+    GetFleetRoleCredentialsOutcome localOutcome;
+    if (ResolveFleetRoleCredentialsLocally(*webSocketRequest, localOutcome)) {
+        m_taskScheduler->Post([onComplete, localOutcome] { onComplete(localOutcome); });
+        return;
+    }
+
+    std::string roleArn = webSocketRequest->GetRoleArn();
+    SendSocketMessageWithRetriesAsync(webSocketRequest, [this, roleArn, onComplete](const GenericOutcome &rawResponse) {
+        onComplete(ToGetFleetRoleCredentialsOutcome(roleArn, rawResponse));
+    });
+}
+
 void Aws::GameLift::Internal::GameLiftServerState::GetOverrideParams(
         char **webSocketUrl,
         char **authToken,
@@ -1096,37 +1486,37 @@ void Aws::GameLift::Internal::GameLiftServerState::GetOverrideParams(
     *sessionToken = std::getenv(ENV_VAR_SESSION_TOKEN);
 
     if (*webSocketUrl != nullptr) {
-        spdlog::info("Env override for webSocketUrl: {}", *webSocketUrl);
+        SPDLOG_INFO("Env override for webSocketUrl: {}", *webSocketUrl);
     }
 
     if (*authToken != nullptr) {
-        spdlog::info("Using env override for authToken");
+        SPDLOG_INFO("Using env override for authToken");
     }
 
     if (*processId != nullptr) {
-        spdlog::info("Env override for processId: {}", *processId);
+        SPDLOG_INFO("Env override for processId: {}", *processId);
         if (std::strcmp(*processId, AGENTLESS_CONTAINER_PROCESS_ID) == 0) {
             std::string guidValue = GuidGenerator::GenerateGuid();
             *processId = new char[guidValue.size() + 1];
             std::strcpy(*processId, guidValue.c_str());
-            spdlog::info("Auto Generated ProcessId, new value is: {}", *processId);
+            SPDLOG_INFO("Auto Generated ProcessId, new value is: {}", *processId);
         }
     }
 
     if (*hostId != nullptr) {
-        spdlog::info("Env override for hostId: {}", *hostId);
+        SPDLOG_INFO("Env override for hostId: {}", *hostId);
     }
 
     if (*fleetId != nullptr) {
-        spdlog::info("Env override for fleetId: {}", *fleetId);
+        SPDLOG_INFO("Env override for fleetId: {}", *fleetId);
     }
 
     if (*computeType != nullptr) {
-        spdlog::info("Env override for computeType: {}", *computeType);
+        SPDLOG_INFO("Env override for computeType: {}", *computeType);
     }
 
     if (*awsRegion != nullptr) {
-        spdlog::info("Env override for awsRegion: {}", *awsRegion);
+        SPDLOG_INFO("Env override for awsRegion: {}", *awsRegion);
     }
     // We are not logging AWS Credentials for security reasons.
 }
@@ -1153,18 +1543,42 @@ Outcome<std::map<std::string, std::string>, std::string> Aws::GameLift::Internal
     return AwsSigV4Utility::GenerateSigV4QueryParameters(sigV4Params);
 }
 
-void Aws::GameLift::Internal::GameLiftServerState::HealthCheck() {
-    // Seed the random number generator used to generate healthCheck interval jitters
-    std::srand(std::time(0));
+void Aws::GameLift::Internal::GameLiftServerState::StartHealthCheck() {
+    m_taskScheduler->Post([this] {
+        // Seed the random number generator used to generate healthCheck interval jitters
+        std::srand(std::time(0));
+        HealthCheck(++m_healthCheckGeneration);
+    });
+}
+
+void Aws::GameLift::Internal::GameLiftServerState::HealthCheck(int generation) {
+    if (!m_processReady || generation != m_healthCheckGeneration) {
+        return;
+    }
+    ReportHealth();
+    int nextHealthCheckMillis = GetNextHealthCheckIntervalMillis();
+    SPDLOG_INFO("Performing HealthCheck(), processReady is true, wait for {} ms for next health check", nextHealthCheckMillis);
+    m_taskScheduler->PostAfter(nextHealthCheckMillis, [this, generation] { HealthCheck(generation); });
+}
 
-    while (m_processReady) {
-        std::ignore = std::async(std::launch::async, &Internal::GameLiftServerState::ReportHealth, this);
-        std::chrono::duration<long int, std::ratio<1, 1000>> time = std::chrono::milliseconds(GetNextHealthCheckIntervalMillis());
-        std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-        // If the lambda below returns false, the thread will wait until "time" millis expires. If
-        // it returns true, the thread immediately continues.
-        spdlog::info("Performing HealthCheck(), processReady is true, wait for {} ms for next health check", time.count());
-        m_healthCheckConditionVariable.wait_for(lock, time, [&]() { return m_healthCheckInterrupted; });
+void Aws::GameLift::Internal::GameLiftServerState::ReportHealthStatus(const std::shared_ptr<bool> &healthReported, bool health) {
+    if (*healthReported) {
+        return;
+    }
+    *healthReported = true;
+    SPDLOG_INFO("Received Health Response: {} from Server Process: {}", health, m_processId);
+
+    if (GetWebSocketClientManager() || GetCurrentWebSocketClientWrapper()) {
+        SPDLOG_INFO("Trying to report process health as {} for process {}", health, m_processId);
+        std::shared_ptr<Message> request = std::make_shared<HeartbeatServerProcessRequest>(HeartbeatServerProcessRequest().WithHealthy(health));
+        std::string processId = m_processId;
+        SendSocketMessageWithRetriesAsync(request, [processId](const GenericOutcome &outcome) {
+            if (!outcome.IsSuccess()) {
+                SPDLOG_ERROR("Error reporting process health for process {}.", processId);
+            }
+        });
+    } else {
+        SPDLOG_ERROR("Tried to report process health for process {} with no active connection", m_processId);
     }
 }
 
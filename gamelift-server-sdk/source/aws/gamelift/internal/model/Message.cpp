@@ -12,24 +12,34 @@
 
 #include <aws/gamelift/internal/model/Message.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
-#include <aws/gamelift/internal/util/RandomStringGenerator.h>
+#include <aws/gamelift/internal/util/RequestId.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
 std::string Message::Serialize() const {
-    // Create the buffer & Writer for the object
+    // Create the buffer for the object
     rapidjson::StringBuffer buffer;
+    if (Serialize(buffer)) {
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+    return "";
+}
+
+bool Message::Serialize(rapidjson::StringBuffer &buffer) const {
+    // Clear() keeps the buffer's capacity, so a reused buffer does not reallocate
+    buffer.Clear();
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
     // Start the object and call Serialize to serialize.
     writer.StartObject();
     if (Serialize(&writer)) {
         writer.EndObject();
-        return buffer.GetString();
+        return true;
     }
-    return "";
+    buffer.Clear();
+    return false;
 }
 
 bool Message::Deserialize(const std::string &jsonString) {
@@ -60,7 +70,7 @@ std::ostream &operator<<(std::ostream &os, const Message &message) {
     return os;
 }
 
-std::string Message::GenerateRandomRequestId() { return RandomStringGenerator::GenerateRandomAlphaNumericString(32); }
+std::string Message::GenerateRandomRequestId() { return RequestId::Generate().ToString(); }
 
 } // namespace Internal
 } // namespace GameLift
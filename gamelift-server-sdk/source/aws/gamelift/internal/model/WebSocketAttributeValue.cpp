@@ -10,6 +10,7 @@
  */
 
 #include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/util/LoggerHelper.h>
 #include <spdlog/spdlog.h>
 
 namespace Aws {
@@ -27,7 +28,7 @@ std::string WebSocketAttributeValue::Serialize() const {
         writer.EndObject();
         return buffer.GetString();
     }
-    spdlog::warn("Could not parse into WebSocketAttributeValue");
+    SPDLOG_WARN("Could not parse into WebSocketAttributeValue");
     return "";
 }
 
@@ -35,7 +36,7 @@ bool WebSocketAttributeValue::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
     rapidjson::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
-        spdlog::error("WebSocketAttributeValue: Parse error found for: {}", jsonString);
+        SPDLOG_ERROR("WebSocketAttributeValue: Parse error found for: {}", LoggerHelper::TruncatePayload(jsonString));
         return false;
     }
 
@@ -11,6 +11,7 @@
 
 #include <aws/gamelift/internal/model/WebSocketPlayer.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/LoggerHelper.h>
 #include <iostream>
 #include <spdlog/spdlog.h>
 
@@ -34,7 +35,7 @@ std::string WebSocketPlayer::Serialize() const {
         writer.EndObject();
         return buffer.GetString();
     }
-    spdlog::warn("Could not parse into WebSocketPlayer");
+    SPDLOG_WARN("Could not parse into WebSocketPlayer");
     return "";
 }
 
@@ -42,7 +43,7 @@ bool WebSocketPlayer::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
     rapidjson::Document doc;
     if (doc.Parse(jsonString.c_str()).HasParseError()) {
-        spdlog::error("WebSocketPlayer: Parse error found for: {}", jsonString);
+        SPDLOG_ERROR("WebSocketPlayer: Parse error found for: {}", LoggerHelper::TruncatePayload(jsonString));
         return false;
     }
 
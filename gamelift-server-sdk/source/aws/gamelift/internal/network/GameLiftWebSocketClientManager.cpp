@@ -26,7 +26,7 @@ namespace Internal {
 
 GenericOutcome GameLiftWebSocketClientManager::Connect(std::string websocketUrl, const std::string &authToken, const std::string &processId,
                                                        const std::string &hostId, const std::string &fleetId, const std::map<std::string, std::string> &sigV4QueryParameters) {
-    spdlog::info("Connecting to GameLift WebSocket server. websocketUrl: {}, processId: {}, hostId: {}, fleetId: {}",
+    SPDLOG_INFO("Connecting to GameLift WebSocket server. websocketUrl: {}, processId: {}, hostId: {}, fleetId: {}",
            websocketUrl.c_str(), processId.c_str(), hostId.c_str(), fleetId.c_str());
 
     // Due to the websocket library we're using, base URLs must end with a "/". Ensure that it is
@@ -61,13 +61,25 @@ GenericOutcome GameLiftWebSocketClientManager::Connect(std::string websocketUrl,
 }
 
 GenericOutcome GameLiftWebSocketClientManager::SendSocketMessage(Message &message) {
-    // Serialize the message
-    std::string jsonMessage = message.Serialize();
+    // Serialize the message into a per-thread buffer. The buffer keeps its capacity between sends, so
+    // frequent messages (heartbeats, player session updates) don't allocate once it has grown. The send
+    // is synchronous and websocketpp copies the bytes, so the buffer is free again when it returns.
+    static thread_local rapidjson::StringBuffer buffer;
+    message.Serialize(buffer);
 
-    GenericOutcome outcome = m_webSocketClientWrapper->SendSocketMessage(message.GetRequestId(), jsonMessage);
+    GenericOutcome outcome = m_webSocketClientWrapper->SendSocketMessage(message.GetRequestId(), buffer.GetString(), buffer.GetSize());
     return outcome;
 }
 
+void GameLiftWebSocketClientManager::SendSocketMessageAsync(Message &message, const std::function<void(const GenericOutcome &)> &onResponse) {
+    // The wrapper copies the bytes into the outgoing websocket message before returning, so a
+    // per-thread buffer works here too even though the response arrives later.
+    static thread_local rapidjson::StringBuffer buffer;
+    message.Serialize(buffer);
+
+    m_webSocketClientWrapper->SendSocketMessageAsync(message.GetRequestId(), buffer.GetString(), buffer.GetSize(), onResponse);
+}
+
 void GameLiftWebSocketClientManager::Disconnect() { m_webSocketClientWrapper->Disconnect(); }
 
 bool GameLiftWebSocketClientManager::EndsWith(const std::string &actualString, const std::string &ending) {
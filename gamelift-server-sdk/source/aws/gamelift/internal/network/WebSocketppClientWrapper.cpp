@@ -15,7 +15,11 @@
 #include <aws/gamelift/internal/model/ResponseMessage.h>
 #include <aws/gamelift/internal/retry/GeometricBackoffRetryStrategy.h>
 #include <aws/gamelift/internal/retry/RetryingCallable.h>
+#include <aws/gamelift/internal/util/LoggerHelper.h>
+#include <aws/gamelift/internal/util/RequestId.h>
 #include <memory>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <websocketpp/error.hpp>
 #include <spdlog/spdlog.h>
 
@@ -25,6 +29,11 @@ namespace Internal {
 
 WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient)
     : m_webSocketClient(webSocketClient), m_connectionStateChanged(false) {
+    // Size the in-flight tables up front so a burst of requests doesn't rehash under the shard locks
+    for (PendingRequestShard &shard : m_pendingRequestShards) {
+        shard.requests.reserve(PENDING_REQUEST_SHARD_CAPACITY);
+    }
+
     // configure logging. comment these out to get websocket logs on stdout for debugging
     m_webSocketClient->clear_access_channels(websocketpp::log::alevel::all);
     m_webSocketClient->clear_error_channels(websocketpp::log::elevel::all);
@@ -76,12 +85,16 @@ WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppCl
 }
 
 WebSocketppClientWrapper::~WebSocketppClientWrapper() {
+    // Fail anything still waiting for a response. This also cancels the timeout timers, which would
+    // otherwise keep the socket threads running until they expire.
+    FailPendingRequests(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
+
     // stop perpetual mode, allowing the websocketClient to destroy itself
     if (m_webSocketClient) {
         m_webSocketClient->stop_perpetual();
     }
 
-    spdlog::info("Destroying WebsocketPPClientWrapper");
+    SPDLOG_INFO("Destroying WebsocketPPClientWrapper");
     // close connections and join the thread
     if (m_connection && m_connection->get_state() == websocketpp::session::state::open) {
         Disconnect();
@@ -95,7 +108,7 @@ WebSocketppClientWrapper::~WebSocketppClientWrapper() {
 }
 
 GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
-    spdlog::info("Opening Connection");
+    SPDLOG_INFO("Opening Connection");
     // Perform connection with retries.
     // This attempts to start up a new websocket connection / thread
     m_uri = uri;
@@ -104,26 +117,26 @@ GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
     RetryingCallable callable = RetryingCallable::Builder()
                                     .WithRetryStrategy(&retryStrategy)
                                     .WithCallable([this, &uri, &errorCode] {
-                                        spdlog::info("Attempting to perform connection");
+                                        SPDLOG_INFO("Attempting to perform connection");
                                         WebSocketppClientType::connection_ptr newConnection = PerformConnect(uri, errorCode);
                                         if (newConnection && newConnection->get_state() == websocketpp::session::state::open) {
-                                            spdlog::info("Connection established, transitioning traffic");
+                                            SPDLOG_INFO("Connection established, transitioning traffic");
                                             // "Flip" traffic from our old websocket to our new websocket. Close the old one
                                             // if necessary
                                             WebSocketppClientType::connection_ptr oldConnection = m_connection;
                                             m_connection = newConnection;
                                             if (oldConnection && oldConnection->get_state() == websocketpp::session::state::open) {
-                                                spdlog::info("Closing previous connection");
+                                                SPDLOG_INFO("Closing previous connection");
                                                 websocketpp::lib::error_code closeErrorCode;
                                                 m_webSocketClient->close(oldConnection->get_handle(), websocketpp::close::status::going_away,
                                                                          "Websocket client reconnecting", closeErrorCode);
                                                 if (errorCode.value()) {
-                                                    spdlog::warn("Failed to close old websocket after a connection refresh, ignoring.");
+                                                    SPDLOG_WARN("Failed to close old websocket after a connection refresh, ignoring.");
                                                 }
                                             }
                                             return true;
                                         } else {
-                                            spdlog::warn("Connection to Amazon GameLift Servers websocket server failed. Retrying connection if possible.");
+                                            SPDLOG_WARN("Connection to Amazon GameLift Servers websocket server failed. Retrying connection if possible.");
                                             return false;
                                         }
                                     })
@@ -131,10 +144,10 @@ GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
     callable.call();
 
     if (IsConnected()) {
-        spdlog::info("Connected to endpoint");
+        SPDLOG_INFO("Connected to endpoint");
         return GenericOutcome(nullptr);
     } else {
-        spdlog::error("Connection to Amazon GameLift Servers websocket server failed. See error message in InitSDK() outcome for details.");
+        SPDLOG_ERROR("Connection to Amazon GameLift Servers websocket server failed. See error message in InitSDK() outcome for details.");
         m_connection = nullptr;
         switch (errorCode.value()) {
         case websocketpp::error::server_only:
@@ -182,15 +195,15 @@ GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
 }
 
 WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(const Uri &uri, websocketpp::lib::error_code &errorCode) {
-    spdlog::info("Performing connection");
+    SPDLOG_INFO("Performing connection");
     errorCode.clear();
     // Create connection request
     WebSocketppClientType::connection_ptr newConnection = m_webSocketClient->get_connection(uri.GetUriString(), errorCode);
     if (errorCode.value()) {
-        spdlog::error("Failed to GetConnection. ERROR: {}", errorCode.message());
+        SPDLOG_ERROR("Failed to GetConnection. ERROR: {}", errorCode.message());
         return newConnection;
     } else {
-        spdlog::info("Connection request created successfully. Waiting for connection to establish...");
+        SPDLOG_INFO("Connection request created successfully. Waiting for connection to establish...");
     }
 
     // Queue a new connection request (the socket thread will act on it and attempt to connect)
@@ -198,14 +211,14 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
         m_webSocketClient->connect(newConnection);
     }
     catch (const std::exception& e) {
-        spdlog::error("Exception while trying to connect with the webSocketClient: {}", e.what());
+        SPDLOG_ERROR("Exception while trying to connect with the webSocketClient: {}", e.what());
     }
-    spdlog::info("Connection request queued.");
+    SPDLOG_INFO("Connection request queued.");
     // Wait for connection to succeed or fail (this makes connection synchronous)
     {
         std::unique_lock<std::mutex> lk(m_lock);
         m_cond.wait(lk, [this] { return m_connectionStateChanged; });
-        spdlog::info("Connection state changed: {}", m_fail_error_code.message());
+        SPDLOG_INFO("Connection state changed: {}", m_fail_error_code.message());
         errorCode = m_fail_error_code;
         // Reset
         m_connectionStateChanged = false;
@@ -213,18 +226,23 @@ WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(c
     }
 
     if (errorCode.value()) {
-        spdlog::error("Connection failed with errorCode: {}", errorCode.message());
+        SPDLOG_ERROR("Connection failed with errorCode: {}", errorCode.message());
     }
     else {
-        spdlog::info("Connection established successfully.");
+        SPDLOG_INFO("Connection established successfully.");
     }
 
     return newConnection;
 }
 
 GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const std::string &message) {
-    if (requestId.empty()) {
-        spdlog::error("Request does not have request ID, cannot process");
+    return SendSocketMessage(requestId, message.data(), message.size());
+}
+
+GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const char *message, size_t length) {
+    RequestId pendingRequestId;
+    if (!RequestId::Parse(requestId, pendingRequestId)) {
+        SPDLOG_ERROR("Request does not have a valid request ID, cannot process");
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
     }
 
@@ -232,45 +250,37 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &re
     while(!IsConnected()) {
         // m_connection will be null if reconnect failed after max reties
         if(m_connection == nullptr || ++waitForReconnectRetryCount >= WAIT_FOR_RECONNECT_MAX_RETRIES) {
-            spdlog::warn("WebSocket is not connected... WebSocket failed to send message due to an error.");
+            SPDLOG_WARN("WebSocket is not connected... WebSocket failed to send message due to an error.");
             return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
         }
-        spdlog::warn("WebSocket is not connected... isConnected: {}", IsConnected());
+        SPDLOG_WARN("WebSocket is not connected... isConnected: {}", IsConnected());
         std::this_thread::sleep_for(std::chrono::seconds(WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS));
     }
 
-    std::future<GenericOutcome> responseFuture;
-    // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
-    {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        // This indicates we've already sent this message, and it's still in flight
-        if (m_requestIdToPromise.count(requestId) > 0) {
-            spdlog::error("Request {} already exists", requestId);
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
-        }
-
-        std::promise<GenericOutcome> responsePromise;
-        responseFuture = responsePromise.get_future();
-        m_requestIdToPromise[requestId] = std::move(responsePromise);
+    // The promise is shared with the response handler, which may still run after a timeout
+    std::shared_ptr<std::promise<GenericOutcome>> responsePromise = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> responseFuture = responsePromise->get_future();
+    PendingRequest pendingRequest;
+    pendingRequest.onResponse = [responsePromise](const GenericOutcome &response) { responsePromise->set_value(response); };
+    if (!AddPendingRequest(pendingRequestId, pendingRequest)) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
     }
 
-    GenericOutcome immediateResponse = SendSocketMessageAsync(message);
+    GenericOutcome immediateResponse = WriteSocketMessage(message, length);
 
     if (!immediateResponse.IsSuccess()) {
-        spdlog::error("Send Socket Message immediate response failed with error {}: {}",
+        SPDLOG_ERROR("Send Socket Message immediate response failed with error {}: {}",
                       immediateResponse.GetError().GetErrorName(), immediateResponse.GetError().GetErrorMessage());
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        m_requestIdToPromise.erase(requestId);
+        TakePendingRequest(pendingRequestId);
         return immediateResponse;
     }
 
     std::future_status promiseStatus = responseFuture.wait_for(std::chrono::milliseconds(SERVICE_CALL_TIMEOUT_MILLIS));
 
     if (promiseStatus == std::future_status::timeout) {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        spdlog::error("Response not received within the time limit of {} ms for request {}", SERVICE_CALL_TIMEOUT_MILLIS, requestId);
-        spdlog::warn("isConnected: {}", IsConnected());
-        m_requestIdToPromise.erase(requestId);
+        SPDLOG_ERROR("Response not received within the time limit of {} ms for request {}", SERVICE_CALL_TIMEOUT_MILLIS, requestId);
+        SPDLOG_WARN("isConnected: {}", IsConnected());
+        TakePendingRequest(pendingRequestId);
         // If a call times out, retry
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE));
     }
@@ -278,17 +288,121 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &re
     return responseFuture.get();
 }
 
-GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &message) {
-    if (!m_connection) {
-        spdlog::error("Cannot send message: m_connection is null");
+void WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &requestId, const char *message, size_t length,
+                                                      const std::function<void(const GenericOutcome &)> &onResponse) {
+    RequestId pendingRequestId;
+    if (!RequestId::Parse(requestId, pendingRequestId)) {
+        SPDLOG_ERROR("Request does not have a valid request ID, cannot process");
+        onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION)));
+        return;
+    }
+
+    // Unlike the synchronous send, don't wait here for a reconnect to finish. Report a retriable
+    // failure and let the caller back off; m_connection is null if reconnect failed after max retries.
+    if (!IsConnected()) {
+        SPDLOG_WARN("WebSocket is not connected... isConnected: {}", IsConnected());
+        onResponse(GenericOutcome(GameLiftError(m_connection == nullptr ? GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE
+                                                                        : GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+        return;
+    }
+
+    PendingRequest pendingRequest;
+    pendingRequest.onResponse = onResponse;
+    // The timer runs on the socket threads. If the response arrives first, taking the request
+    // cancels the timer and the handler sees an error code.
+    pendingRequest.timeoutTimer = m_webSocketClient->set_timer(SERVICE_CALL_TIMEOUT_MILLIS, [this, pendingRequestId](const websocketpp::lib::error_code &errorCode) {
+        if (errorCode) {
+            return;
+        }
+        std::function<void(const GenericOutcome &)> timedOutHandler = TakePendingRequest(pendingRequestId);
+        if (timedOutHandler) {
+            SPDLOG_ERROR("Response not received within the time limit of {} ms for request {}", SERVICE_CALL_TIMEOUT_MILLIS, pendingRequestId.ToString());
+            timedOutHandler(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+        }
+    });
+    if (!AddPendingRequest(pendingRequestId, pendingRequest)) {
+        pendingRequest.timeoutTimer->cancel();
+        onResponse(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION)));
+        return;
+    }
+
+    GenericOutcome immediateResponse = WriteSocketMessage(message, length);
+    if (!immediateResponse.IsSuccess()) {
+        SPDLOG_ERROR("Send Socket Message immediate response failed with error {}: {}",
+                      immediateResponse.GetError().GetErrorName(), immediateResponse.GetError().GetErrorMessage());
+        std::function<void(const GenericOutcome &)> failedHandler = TakePendingRequest(pendingRequestId);
+        if (failedHandler) {
+            failedHandler(immediateResponse);
+        }
+    }
+}
+
+WebSocketppClientWrapper::PendingRequestShard &WebSocketppClientWrapper::GetPendingRequestShard(const RequestId &requestId) {
+    return m_pendingRequestShards[RequestId::Hash()(requestId) % PENDING_REQUEST_SHARD_COUNT];
+}
+
+bool WebSocketppClientWrapper::AddPendingRequest(const RequestId &requestId, const PendingRequest &pendingRequest) {
+    // Lock the request's shard whenever we make use of it to avoid concurrent writes/reads
+    PendingRequestShard &shard = GetPendingRequestShard(requestId);
+    std::lock_guard<std::mutex> lock(shard.lock);
+    // This indicates we've already sent this message, and it's still in flight
+    if (!shard.requests.insert(std::make_pair(requestId, pendingRequest)).second) {
+        SPDLOG_ERROR("Request {} already exists", requestId.ToString());
+        return false;
+    }
+    return true;
+}
+
+std::function<void(const GenericOutcome &)> WebSocketppClientWrapper::TakePendingRequest(const RequestId &requestId) {
+    PendingRequest pendingRequest;
+    {
+        PendingRequestShard &shard = GetPendingRequestShard(requestId);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        auto pendingRequestIterator = shard.requests.find(requestId);
+        if (pendingRequestIterator == shard.requests.end()) {
+            return nullptr;
+        }
+        pendingRequest = std::move(pendingRequestIterator->second);
+        shard.requests.erase(pendingRequestIterator);
+    }
+    if (pendingRequest.timeoutTimer) {
+        pendingRequest.timeoutTimer->cancel();
+    }
+    return pendingRequest.onResponse;
+}
+
+void WebSocketppClientWrapper::FailPendingRequests(GAMELIFT_ERROR_TYPE errorType) {
+    for (PendingRequestShard &shard : m_pendingRequestShards) {
+        PendingRequestMap pendingRequests;
+        {
+            std::lock_guard<std::mutex> lock(shard.lock);
+            pendingRequests.swap(shard.requests);
+        }
+        for (auto &pendingRequest : pendingRequests) {
+            if (pendingRequest.second.timeoutTimer) {
+                pendingRequest.second.timeoutTimer->cancel();
+            }
+            pendingRequest.second.onResponse(GenericOutcome(GameLiftError(errorType)));
+        }
+    }
+}
+
+GenericOutcome WebSocketppClientWrapper::WriteSocketMessage(const char *message, size_t length) {
+    WebSocketppClientType::connection_ptr connection = m_connection;
+    if (!connection) {
+        SPDLOG_ERROR("Cannot send message: m_connection is null");
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
     }
 
-    spdlog::info("Sending Socket Message, isConnected:{}", IsConnected());
+    SPDLOG_INFO("Sending Socket Message, isConnected:{}", IsConnected());
+    // Copy the serialized bytes straight into a websocketpp message sized for them and hand ownership
+    // of it to websocketpp, rather than building an intermediate std::string for the payload.
+    WebSocketppClientType::message_ptr outgoingMessage = connection->get_message(websocketpp::frame::opcode::text, length);
+    outgoingMessage->append_payload(message, length);
     websocketpp::lib::error_code errorCode;
-    m_webSocketClient->send(m_connection->get_handle(), message.c_str(), websocketpp::frame::opcode::text, errorCode);
+    m_webSocketClient->send(connection->get_handle(), outgoingMessage, errorCode);
     if (errorCode.value()) {
-        spdlog::error("Error Sending Socket Message: {}", errorCode.value());
+        SPDLOG_ERROR("Error Sending Socket Message: {}", errorCode.value());
         switch (errorCode.value()) {
         case websocketpp::error::no_outgoing_buffers:
             // If buffers are full, send will fail. Retryable since buffers can free up as messages
@@ -303,19 +417,22 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::strin
 }
 
 void WebSocketppClientWrapper::Disconnect() {
-    spdlog::info("Disconnecting WebSocket");
+    SPDLOG_INFO("Disconnecting WebSocket");
     if (m_connection != nullptr) {
         websocketpp::lib::error_code ec;
         m_webSocketClient->close(m_connection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
         if (ec) {
-	        spdlog::error("Error initiating close: {}",ec.message());
+	        SPDLOG_ERROR("Error initiating close: {}",ec.message());
         }
         m_connection = nullptr;
     }
+    // No response can arrive on the closed connection. Let callers retry, e.g. on the connection that
+    // replaces this one, instead of waiting for the request timeout.
+    FailPendingRequests(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE);
 }
 
-void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) {
-    spdlog::info("Registering GameLift CallBack for: {}", gameLiftEvent);
+void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(const rapidjson::Value &)> &callback) {
+    SPDLOG_INFO("Registering GameLift CallBack for: {}", gameLiftEvent);
     m_eventHandlers[gameLiftEvent] = callback;
 }
 
@@ -325,7 +442,7 @@ bool WebSocketppClientWrapper::IsConnected() {
 }
 
 void WebSocketppClientWrapper::OnConnected(websocketpp::connection_hdl connection) {
-    spdlog::info("Connected to WebSocket");
+    SPDLOG_INFO("Connected to WebSocket");
     // aquire lock and set condition variables (let main thread know connection is successful)
     {
         std::lock_guard<std::mutex> lk(m_lock);
@@ -337,7 +454,7 @@ void WebSocketppClientWrapper::OnConnected(websocketpp::connection_hdl connectio
 
 void WebSocketppClientWrapper::OnError(websocketpp::connection_hdl connection) {
     auto con = m_webSocketClient->get_con_from_hdl(connection);
-    spdlog::error("Error Connecting to WebSocket");
+    SPDLOG_ERROR("Error Connecting to WebSocket");
 
     // aquire lock and set condition variables (let main thread know an error has occurred)
     {
@@ -351,18 +468,27 @@ void WebSocketppClientWrapper::OnError(websocketpp::connection_hdl connection) {
 }
 
 void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection, websocketpp::config::asio_client::message_type::ptr msg) {
-    std::string message = msg->get_payload();
-    spdlog::info("Received message from websocket endpoint");
+    SPDLOG_INFO("Received message from websocket endpoint");
+    // The payload buffer belongs to this message and is not read again once dispatched, so parse it
+    // in-situ: string values in the document point straight into the buffer instead of being copied.
+    std::string &payload = msg->get_raw_payload();
+    SPDLOG_TRACE("Received message with raw data ({} bytes): {}", payload.size(), LoggerHelper::TruncatePayload(payload));
+
+    rapidjson::Document document;
+    if (document.ParseInsitu(&payload[0]).HasParseError() || !document.IsObject()) {
+        SPDLOG_ERROR("Error Deserializing Message");
+        return;
+    }
 
     ResponseMessage responseMessage;
     Message &gameLiftMessage = responseMessage;
-    if (!gameLiftMessage.Deserialize(message)) {
-        spdlog::error("Error Deserializing Message");
+    if (!gameLiftMessage.Deserialize(document)) {
+        SPDLOG_ERROR("Error Deserializing Message");
         return;
     }
 
     const std::string &action = responseMessage.GetAction();
-    spdlog::info("Deserialized Message has Action: {}", action);
+    SPDLOG_INFO("Deserialized Message has Action: {}", action);
     const std::string &requestId = responseMessage.GetRequestId();
     const int statusCode = responseMessage.GetStatusCode();
     const std::string &errorMessage = responseMessage.GetErrorMessage();
@@ -373,21 +499,31 @@ void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection,
     // RequestId will be empty when we get a message not associated with a request, in which case we
     // don't expect a 200 status code either.
     if (statusCode != OK_STATUS_CODE && !requestId.empty()) {
-        response = GenericOutcome(GameLiftError(statusCode, message.c_str()));
+        // The raw payload was consumed by the in-situ parse, so write the document back out for the
+        // error message. This only happens on the (rare) error path.
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        response = GenericOutcome(GameLiftError(statusCode, buffer.GetString()));
     } else {
         // If we got a success response, and we have a special event handler for this action, invoke
-        // it to get the real parsed result
-        if (m_eventHandlers.count(action)) {
-            spdlog::info("Executing Amazon GameLift Servers Event Handler for {}", action);
-            response = m_eventHandlers[action](message);
+        // it with the already-parsed document to get the real parsed result
+        auto eventHandler = m_eventHandlers.find(action);
+        if (eventHandler != m_eventHandlers.end()) {
+            SPDLOG_INFO("Executing Amazon GameLift Servers Event Handler for {}", action);
+            response = eventHandler->second(document);
         }
     }
 
-    // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
-    std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-    if (m_requestIdToPromise.count(requestId) > 0) {
-        m_requestIdToPromise[requestId].set_value(response);
-        m_requestIdToPromise.erase(requestId);
+    // Complete the request outside the lock, the handler may start another request. Messages that
+    // aren't a response to one of our requests carry no (or an unknown) request id.
+    RequestId pendingRequestId;
+    std::function<void(const GenericOutcome &)> responseHandler;
+    if (RequestId::Parse(requestId, pendingRequestId)) {
+        responseHandler = TakePendingRequest(pendingRequestId);
+    }
+    if (responseHandler) {
+        responseHandler(response);
     }
 }
 
@@ -404,14 +540,14 @@ void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
                            || localCloseCode == websocketpp::close::status::going_away
                            || remoteCloseCode == websocketpp::close::status::normal
                            || remoteCloseCode == websocketpp::close::status::going_away;
-    spdlog::info("Connection to Amazon GameLift Servers websocket server lost, Local Close Code = {}, Remote Close Code = {}.",
+    SPDLOG_INFO("Connection to Amazon GameLift Servers websocket server lost, Local Close Code = {}, Remote Close Code = {}.",
            websocketpp::close::status::get_string(localCloseCode).c_str(),
            websocketpp::close::status::get_string(remoteCloseCode).c_str());
     if(isNormalClosure) {
-        spdlog::info("Normal Connection Closure, skipping reconnect.");
+        SPDLOG_INFO("Normal Connection Closure, skipping reconnect.");
         return;
     } else {
-        spdlog::info("Abnormal Connection Closure, reconnecting.");
+        SPDLOG_INFO("Abnormal Connection Closure, reconnecting.");
         WebSocketppClientWrapper::Connect(m_uri);
     }
 }
@@ -421,8 +557,8 @@ void WebSocketppClientWrapper::OnInterrupt(websocketpp::connection_hdl connectio
     auto remoteEndpoint = connectionPointer->get_remote_endpoint();
     auto host = connectionPointer->get_host();
     auto port = connectionPointer->get_port();
-    spdlog::warn("Interruption Happened");
-    spdlog::info("In OnInterrupt(), isConnected:{}, endpoint: {}, host: {}, port: {}", IsConnected(), remoteEndpoint, host, port);
+    SPDLOG_WARN("Interruption Happened");
+    SPDLOG_INFO("In OnInterrupt(), isConnected:{}, endpoint: {}, host: {}, port: {}", IsConnected(), remoteEndpoint, host, port);
 }
 
 } // namespace Internal
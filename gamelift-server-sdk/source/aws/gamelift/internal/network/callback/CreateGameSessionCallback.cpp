@@ -21,7 +21,15 @@ namespace GameLift {
 namespace Internal {
 
 GenericOutcome CreateGameSessionCallback::OnStartGameSession(const std::string &data) {
-    spdlog::info("OnStartGameSession Received with raw data: {}", data);
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnStartGameSession(document);
+}
+
+GenericOutcome CreateGameSessionCallback::OnStartGameSession(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnStartGameSession Received");
     CreateGameSessionMessage createGameSessionMessage;
     Message &message = createGameSessionMessage;
     message.Deserialize(data);
@@ -20,7 +20,15 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const std::string &data) {
-    spdlog::info("OnDescribePlayerSessions Received with raw data: {}", data);
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnDescribePlayerSessions(document);
+}
+
+GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnDescribePlayerSessions Received");
     WebSocketDescribePlayerSessionsResponse *describePlayerSessionsResponse = new WebSocketDescribePlayerSessionsResponse();
     Message *message = describePlayerSessionsResponse;
     message->Deserialize(data);
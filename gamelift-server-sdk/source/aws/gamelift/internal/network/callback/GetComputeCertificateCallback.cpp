@@ -20,7 +20,15 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const std::string &data) {
-    spdlog::info("OnGetComputeCertificate Received");
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnGetComputeCertificateCallback(document);
+}
+
+GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnGetComputeCertificate Received");
     auto *response = new WebSocketGetComputeCertificateResponse();
     Message *message = response;
     message->Deserialize(data);
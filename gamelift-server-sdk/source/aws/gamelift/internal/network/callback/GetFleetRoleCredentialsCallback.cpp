@@ -20,7 +20,15 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const std::string &data) {
-    spdlog::info("OnGetFleetRoleCredentials Received");
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnGetFleetRoleCredentials(document);
+}
+
+GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnGetFleetRoleCredentials Received");
     auto *getFleetRoleCredentialsResponse = new WebSocketGetFleetRoleCredentialsResponse();
     Message *message = getFleetRoleCredentialsResponse;
     message->Deserialize(data);
@@ -20,7 +20,15 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 GenericOutcome RefreshConnectionCallback::OnRefreshConnection(const std::string &data) {
-    spdlog::info("OnRefreshConnection Received with raw data: {}", data);
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnRefreshConnection(document);
+}
+
+GenericOutcome RefreshConnectionCallback::OnRefreshConnection(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnRefreshConnection Received");
     RefreshConnectionMessage refreshConnectionMessage;
     Message &message = refreshConnectionMessage;
     message.Deserialize(data);
@@ -20,7 +20,15 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const std::string &data) {
-    spdlog::info("OnStartMatchBackfill Received with raw data: {}", data);
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnStartMatchBackfill(document);
+}
+
+GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnStartMatchBackfill Received");
     WebSocketStartMatchBackfillResponse *startMatchBackfillResponse = new WebSocketStartMatchBackfillResponse();
     Message *message = startMatchBackfillResponse;
     message->Deserialize(data);
@@ -21,7 +21,15 @@ namespace GameLift {
 namespace Internal {
 
 GenericOutcome TerminateProcessCallback::OnTerminateProcess(const std::string &data) {
-    spdlog::info("OnTerminateProcess Received with raw data: {}", data);
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnTerminateProcess(document);
+}
+
+GenericOutcome TerminateProcessCallback::OnTerminateProcess(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnTerminateProcess Received");
     TerminateProcessMessage terminateProcessMessage;
     Message &message = terminateProcessMessage;
     message.Deserialize(data);
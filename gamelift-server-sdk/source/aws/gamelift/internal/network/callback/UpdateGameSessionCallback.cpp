@@ -21,7 +21,15 @@ namespace GameLift {
 namespace Internal {
 
 GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const std::string &data) {
-    spdlog::info("OnUpdateGameSession Received with raw data: {}", data);
+    rapidjson::Document document;
+    if (document.Parse(data.c_str()).HasParseError()) {
+        document.SetObject();
+    }
+    return OnUpdateGameSession(document);
+}
+
+GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const rapidjson::Value &data) {
+    SPDLOG_INFO("OnUpdateGameSession Received");
     UpdateGameSessionMessage updateGameSessionMessage;
     Message &message = updateGameSessionMessage;
     message.Deserialize(data);
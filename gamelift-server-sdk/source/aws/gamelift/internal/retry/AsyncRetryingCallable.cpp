@@ -0,0 +1,88 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/retry/AsyncRetryingCallable.h>
+#include <spdlog/spdlog.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+// Shared by the scheduled attempts and their callbacks, and lives until the last of them is gone.
+struct AsyncRetryingCallable::State {
+    State(RetryStrategy &retryStrategy, TaskScheduler &taskScheduler, const AsyncCallable &callable, const std::function<void(bool)> &onComplete)
+        : retryStrategy(retryStrategy), taskScheduler(taskScheduler), callable(callable), onComplete(onComplete), failedAttempts(0) {}
+
+    RetryStrategy &retryStrategy;
+    TaskScheduler &taskScheduler;
+    AsyncCallable callable;
+    std::function<void(bool)> onComplete;
+    int failedAttempts;
+};
+
+AsyncRetryingCallable::Builder::Builder() : m_retryStrategy(nullptr), m_taskScheduler(nullptr) {}
+
+AsyncRetryingCallable::Builder &AsyncRetryingCallable::Builder::WithRetryStrategy(RetryStrategy *retryStrategy) {
+    m_retryStrategy = retryStrategy;
+    return *this;
+}
+
+AsyncRetryingCallable::Builder &AsyncRetryingCallable::Builder::WithTaskScheduler(TaskScheduler *taskScheduler) {
+    m_taskScheduler = taskScheduler;
+    return *this;
+}
+
+AsyncRetryingCallable::Builder &AsyncRetryingCallable::Builder::WithCallable(const AsyncCallable &callable) {
+    m_callable = callable;
+    return *this;
+}
+
+AsyncRetryingCallable::Builder &AsyncRetryingCallable::Builder::WithOnComplete(const std::function<void(bool)> &onComplete) {
+    m_onComplete = onComplete;
+    return *this;
+}
+
+AsyncRetryingCallable AsyncRetryingCallable::Builder::Build() const {
+    return AsyncRetryingCallable(*m_retryStrategy, *m_taskScheduler, m_callable, m_onComplete);
+}
+
+AsyncRetryingCallable::AsyncRetryingCallable(RetryStrategy &retryStrategy, TaskScheduler &taskScheduler, const AsyncCallable &callable,
+                                             const std::function<void(bool)> &onComplete)
+    : m_state(std::make_shared<State>(retryStrategy, taskScheduler, callable, onComplete)) {}
+
+void AsyncRetryingCallable::call() {
+    std::shared_ptr<State> state = m_state;
+    state->taskScheduler.Post([state] { Attempt(state); });
+}
+
+void AsyncRetryingCallable::Attempt(const std::shared_ptr<State> &state) {
+    state->callable([state](bool done) { OnAttemptComplete(state, done); });
+}
+
+void AsyncRetryingCallable::OnAttemptComplete(const std::shared_ptr<State> &state, bool done) {
+    if (!done) {
+        state->failedAttempts++;
+        int retryDelayMillis = state->retryStrategy.GetRetryDelayMillis(state->failedAttempts);
+        if (retryDelayMillis >= 0) {
+            SPDLOG_WARN("Attempt {} failed. Retrying in {} milliseconds...", state->failedAttempts, retryDelayMillis);
+            state->taskScheduler.PostAfter(retryDelayMillis, [state] { Attempt(state); });
+            return;
+        }
+    }
+    if (state->onComplete) {
+        state->onComplete(done);
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -25,7 +25,7 @@ void GeometricBackoffRetryStrategy::apply(const std::function<bool(void)> &calla
         if (success) {
             break;
         } else {
-            spdlog::warn("Connection Failed. Retrying in {} seconds...", retryIntervalSeconds);
+            SPDLOG_WARN("Connection Failed. Retrying in {} seconds...", retryIntervalSeconds);
             std::this_thread::sleep_for(std::chrono::seconds(retryIntervalSeconds));
             retryIntervalSeconds *= m_retryFactor;
             retryIntervalSeconds = retryIntervalSeconds > m_maxRetryIntervalSeconds ? m_maxRetryIntervalSeconds : retryIntervalSeconds;
@@ -33,6 +33,18 @@ void GeometricBackoffRetryStrategy::apply(const std::function<bool(void)> &calla
     }
 }
 
+int GeometricBackoffRetryStrategy::GetRetryDelayMillis(int failedAttempts) {
+    if (failedAttempts < 1 || failedAttempts >= m_maxRetries) {
+        return -1;
+    }
+    int retryIntervalSeconds = m_initialRetryIntervalSeconds;
+    for (int i = 1; i < failedAttempts && retryIntervalSeconds < m_maxRetryIntervalSeconds; ++i) {
+        retryIntervalSeconds *= m_retryFactor;
+    }
+    retryIntervalSeconds = retryIntervalSeconds > m_maxRetryIntervalSeconds ? m_maxRetryIntervalSeconds : retryIntervalSeconds;
+    return retryIntervalSeconds * 1000;
+}
+
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -30,13 +30,25 @@ void JitteredGeometricBackoffRetryStrategy::apply(const std::function<bool(void)
         } else {
             std::uniform_int_distribution<> intervalRange(m_minRetryDelayMs, retryIntervalMs);
             int currentInterval = intervalRange(randGenerator);
-            spdlog::warn("Sending Message Failed. Retrying in {} milliseconds...", currentInterval);
+            SPDLOG_WARN("Sending Message Failed. Retrying in {} milliseconds...", currentInterval);
             std::this_thread::sleep_for(std::chrono::milliseconds(currentInterval));
             retryIntervalMs *= m_retryFactor;
         }
     }
 }
 
+int JitteredGeometricBackoffRetryStrategy::GetRetryDelayMillis(int failedAttempts) {
+    if (failedAttempts < 1 || failedAttempts >= m_maxRetries) {
+        return -1;
+    }
+    int retryIntervalMs = m_initialRetryIntervalMs;
+    for (int i = 1; i < failedAttempts; ++i) {
+        retryIntervalMs *= m_retryFactor;
+    }
+    std::uniform_int_distribution<> intervalRange(m_minRetryDelayMs, retryIntervalMs);
+    return intervalRange(m_randGenerator);
+}
+
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
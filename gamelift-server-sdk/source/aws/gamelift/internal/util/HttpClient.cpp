@@ -106,12 +106,12 @@ HttpResponse HttpClient::SendGetRequest(const std::string &url) {
 
 #ifdef _WIN32
         if (closesocket(sock) < 0) {
-            spdlog::warn("Socket close failed, error number: {}", WSAGetLastError());
+            SPDLOG_WARN("Socket close failed, error number: {}", WSAGetLastError());
         }
         WSACleanup();
 #else
         if (close(sock) < 0) {
-            spdlog::warn("Socket close failed, error number: {}", errno);
+            SPDLOG_WARN("Socket close failed, error number: {}", errno);
         }
 #endif
         sock = -1;
@@ -11,42 +11,158 @@
  */
 #include <aws/gamelift/internal/util/LoggerHelper.h>
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
+#include <spdlog/pattern_formatter.h>
+#include <spdlog/sinks/base_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/rotating_file_sink.h>
+#include <mutex>
+#include <vector>
 
 using namespace Aws::GameLift::Internal;
+using Aws::GameLift::Server::Model::LoggerParameters;
+using Aws::GameLift::Server::Model::LogLevel;
+using Aws::GameLift::Server::Model::LogOverflowPolicy;
 
+namespace {
+spdlog::level::level_enum ToSpdlogLevel(LogLevel level) {
+    switch (level) {
+    case LogLevel::Trace:
+        return spdlog::level::trace;
+    case LogLevel::Debug:
+        return spdlog::level::debug;
+    case LogLevel::Info:
+        return spdlog::level::info;
+    case LogLevel::Warn:
+        return spdlog::level::warn;
+    case LogLevel::Error:
+        return spdlog::level::err;
+    case LogLevel::Critical:
+        return spdlog::level::critical;
+    default:
+        return spdlog::level::off;
+    }
+}
+
+LogLevel ToLogLevel(spdlog::level::level_enum level) {
+    switch (level) {
+    case spdlog::level::trace:
+        return LogLevel::Trace;
+    case spdlog::level::debug:
+        return LogLevel::Debug;
+    case spdlog::level::info:
+        return LogLevel::Info;
+    case spdlog::level::warn:
+        return LogLevel::Warn;
+    case spdlog::level::err:
+        return LogLevel::Error;
+    case spdlog::level::critical:
+        return LogLevel::Critical;
+    default:
+        return LogLevel::Off;
+    }
+}
+
+// Hands each log message to the developer's sink, so the SDK can log through the game's own logging.
+class CallbackSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
 #ifdef GAMELIFT_USE_STD
-void LoggerHelper::InitializeLogger(const std::string& process_Id) {
-    auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-    std::string serverSdkLog = "logs/gamelift-server-sdk-";
-    serverSdkLog.append(process_Id).append(".log");
-    auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(serverSdkLog, 10485760, 5);
+    explicit CallbackSink(const Aws::GameLift::Server::Model::LogSink &logSink) : m_logSink(logSink) {}
+#else
+    CallbackSink(Aws::GameLift::Server::Model::LogSinkFn logSink, void *logSinkState) : m_logSink(logSink), m_logSinkState(logSinkState) {}
+#endif
 
-    console_sink->set_pattern("%^[%Y-%m-%d %H:%M:%S] [%l] %v%$");
-    file_sink->set_pattern("[%Y-%m-%d %H:%M:%S] [%l] %v");
+protected:
+    void sink_it_(const spdlog::details::log_msg &msg) override {
+#ifdef GAMELIFT_USE_STD
+        m_logSink(ToLogLevel(msg.level), msg.payload.data(), msg.payload.size());
+#else
+        m_logSink(ToLogLevel(msg.level), msg.payload.data(), msg.payload.size(), m_logSinkState);
+#endif
+    }
 
-    spdlog::logger logger("multi_sink", { console_sink, file_sink });
-    logger.set_level(spdlog::level::info);
-    logger.flush_on(spdlog::level::info);
+    void flush_() override {}
 
-    spdlog::set_default_logger(std::make_shared<spdlog::logger>(logger));
-}
+private:
+#ifdef GAMELIFT_USE_STD
+    Aws::GameLift::Server::Model::LogSink m_logSink;
 #else
-void LoggerHelper::InitializeLogger(const char* process_Id) {
+    Aws::GameLift::Server::Model::LogSinkFn m_logSink;
+    void *m_logSinkState;
+#endif
+};
+
+void InitializeLogger(const std::string &serverSdkLog, const LoggerParameters &loggerParameters) {
     auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-    std::string serverSdkLog = "logs/gamelift-server-sdk-";
-    serverSdkLog.append(process_Id).append(".log");
     auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(serverSdkLog, 10485760, 5);
 
     console_sink->set_pattern("%^[%Y-%m-%d %H:%M:%S] [%l] %v%$");
     file_sink->set_pattern("[%Y-%m-%d %H:%M:%S] [%l] %v");
 
-    spdlog::logger logger("multi_sink", { console_sink, file_sink });
-    logger.set_level(spdlog::level::info);
-    logger.flush_on(spdlog::level::info);
+    std::vector<spdlog::sink_ptr> sinks = {console_sink, file_sink};
+    if (loggerParameters.GetLogSink()) {
+#ifdef GAMELIFT_USE_STD
+        sinks.push_back(std::make_shared<CallbackSink>(loggerParameters.GetLogSink()));
+#else
+        sinks.push_back(std::make_shared<CallbackSink>(loggerParameters.GetLogSink(), loggerParameters.GetLogSinkState()));
+#endif
+    }
+
+    std::shared_ptr<spdlog::logger> logger;
+    if (loggerParameters.IsAsyncLogging()) {
+        // One logging thread for the whole process. Re-initializing the SDK reuses it, since loggers that
+        // are still referenced elsewhere would lose their queue if it was replaced.
+        if (!spdlog::thread_pool()) {
+            spdlog::init_thread_pool(loggerParameters.GetAsyncQueueSize(), 1);
+        }
+        spdlog::async_overflow_policy overflowPolicy = loggerParameters.GetOverflowPolicy() == LogOverflowPolicy::BLOCK
+                                                           ? spdlog::async_overflow_policy::block
+                                                           : spdlog::async_overflow_policy::overrun_oldest;
+        logger = std::make_shared<spdlog::async_logger>("multi_sink", sinks.begin(), sinks.end(), spdlog::thread_pool(), overflowPolicy);
+    } else {
+        logger = std::make_shared<spdlog::logger>("multi_sink", sinks.begin(), sinks.end());
+    }
+    logger->set_level(ToSpdlogLevel(loggerParameters.GetLogLevel()));
+    logger->flush_on(ToSpdlogLevel(loggerParameters.GetFlushLevel()));
+
+    spdlog::set_default_logger(logger);
+    // The periodic flusher is global to spdlog. A zero interval replaces one started by an earlier
+    // initialization with a flusher that never runs.
+    spdlog::flush_every(std::chrono::seconds(loggerParameters.GetFlushIntervalSeconds() > 0 ? loggerParameters.GetFlushIntervalSeconds() : 0));
+}
+} // namespace
 
-    spdlog::set_default_logger(std::make_shared<spdlog::logger>(logger));
+#ifdef GAMELIFT_USE_STD
+void LoggerHelper::InitializeLogger(const std::string& process_Id, const LoggerParameters& loggerParameters) {
+    std::string serverSdkLog = "logs/gamelift-server-sdk-";
+    serverSdkLog.append(process_Id).append(".log");
+    ::InitializeLogger(serverSdkLog, loggerParameters);
+}
+#else
+void LoggerHelper::InitializeLogger(const char* process_Id, const LoggerParameters& loggerParameters) {
+    std::string serverSdkLog = "logs/gamelift-server-sdk-";
+    serverSdkLog.append(process_Id).append(".log");
+    ::InitializeLogger(serverSdkLog, loggerParameters);
 }
 #endif
 
+void LoggerHelper::FlushLogger() {
+    std::shared_ptr<spdlog::logger> logger = spdlog::default_logger();
+    if (!logger) {
+        return;
+    }
+    logger->flush();
+    if (!std::dynamic_pointer_cast<spdlog::async_logger>(logger)) {
+        return;
+    }
+
+    // An async flush is only queued. Hand the sinks to a synchronous logger, so anything logged after Destroy()
+    // is written directly, then release the thread pool: its destructor drains the queue and joins the thread.
+    auto syncLogger = std::make_shared<spdlog::logger>(logger->name(), logger->sinks().begin(), logger->sinks().end());
+    syncLogger->set_level(logger->level());
+    syncLogger->flush_on(logger->flush_level());
+    spdlog::set_default_logger(syncLogger);
+    logger.reset();
+    spdlog::details::registry::instance().set_tp(nullptr);
+    syncLogger->flush();
+}
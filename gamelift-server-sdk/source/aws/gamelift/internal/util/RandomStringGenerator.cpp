@@ -12,14 +12,12 @@
 
 #include <aws/gamelift/internal/util/RandomStringGenerator.h>
 #include <random>
-#include <sstream>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
 std::string RandomStringGenerator::GenerateRandomAlphaNumericString(const int stringLength) {
-    std::stringstream ss;
     static const char alphaNumChars[] = "0123456789"
                                         "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                                         "abcdefghijklmnopqrstuvwxyz";
@@ -29,10 +27,11 @@ std::string RandomStringGenerator::GenerateRandomAlphaNumericString(const int st
     // terminator.
     std::uniform_int_distribution<int> distribution(0, sizeof(alphaNumChars) - 2);
 
-    for (int i = 0; i < stringLength; i++) {
-        ss << alphaNumChars[distribution(randomNumberGenerator)];
+    std::string randomString(stringLength > 0 ? stringLength : 0, '\0');
+    for (char &randomChar : randomString) {
+        randomChar = alphaNumChars[distribution(randomNumberGenerator)];
     }
-    return ss.str();
+    return randomString;
 }
 
 } // namespace Internal
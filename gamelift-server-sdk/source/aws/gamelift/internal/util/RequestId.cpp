@@ -0,0 +1,85 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/RequestId.h>
+#include <random>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+namespace {
+const char HEX_DIGITS[] = "0123456789abcdef";
+
+void WriteHex(uint64_t value, char *buffer) {
+    for (int i = 15; i >= 0; --i) {
+        buffer[i] = HEX_DIGITS[value & 0xF];
+        value >>= 4;
+    }
+}
+
+bool ReadHex(const char *text, uint64_t &value) {
+    value = 0;
+    for (int i = 0; i < 16; ++i) {
+        char c = text[i];
+        uint64_t digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+    return true;
+}
+
+uint64_t GenerateThreadSalt() {
+    std::random_device randomDevice;
+    std::mt19937_64 randomNumberGenerator((static_cast<uint64_t>(randomDevice()) << 32) | randomDevice());
+    return randomNumberGenerator();
+}
+} // namespace
+
+RequestId RequestId::Generate() {
+    static thread_local const uint64_t threadSalt = GenerateThreadSalt();
+    static thread_local uint64_t threadCounter = 0;
+    return RequestId(threadSalt, ++threadCounter);
+}
+
+bool RequestId::Parse(const char *text, size_t length, RequestId &requestId) {
+    uint64_t high;
+    uint64_t low;
+    if (length != TEXT_LENGTH || !ReadHex(text, high) || !ReadHex(text + TEXT_LENGTH / 2, low)) {
+        return false;
+    }
+    requestId = RequestId(high, low);
+    return true;
+}
+
+void RequestId::ToChars(char *buffer) const {
+    WriteHex(m_high, buffer);
+    WriteHex(m_low, buffer + TEXT_LENGTH / 2);
+}
+
+std::string RequestId::ToString() const {
+    char buffer[TEXT_LENGTH];
+    ToChars(buffer);
+    return std::string(buffer, TEXT_LENGTH);
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,119 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/TaskScheduler.h>
+#include <asio.hpp>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <spdlog/spdlog.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+struct TaskScheduler::SharedState {
+    SharedState() : work(new asio::io_service::work(ioService)), shutdown(false) {}
+
+    bool IsShutdown() {
+        std::lock_guard<std::mutex> guard(lock);
+        return shutdown;
+    }
+
+    asio::io_service ioService;
+    // Keeps ioService.run() going while there is nothing to do. Released on shutdown.
+    std::unique_ptr<asio::io_service::work> work;
+    std::mutex lock;
+    // Timers that haven't fired yet, so Shutdown() can cancel them instead of waiting them out.
+    std::set<std::shared_ptr<asio::steady_timer>> pendingTimers;
+    bool shutdown;
+};
+
+TaskScheduler::TaskScheduler() : m_state(std::make_shared<SharedState>()) {
+    std::shared_ptr<SharedState> state = m_state;
+    m_workerThread = std::unique_ptr<std::thread>(new std::thread([state] { state->ioService.run(); }));
+}
+
+TaskScheduler::~TaskScheduler() { Shutdown(); }
+
+void TaskScheduler::Post(const std::function<void()> &task) { PostAfter(0, task); }
+
+void TaskScheduler::PostAfter(int delayMillis, const std::function<void()> &task) {
+    std::shared_ptr<SharedState> state = m_state;
+    std::lock_guard<std::mutex> guard(state->lock);
+    if (state->shutdown) {
+        return;
+    }
+
+    // Tasks that are dropped during shutdown are never run, only destroyed when asio releases the handler.
+    if (delayMillis <= 0) {
+        state->ioService.post([state, task] {
+            if (!state->IsShutdown()) {
+                RunTask(task);
+            }
+        });
+        return;
+    }
+
+    std::shared_ptr<asio::steady_timer> timer = std::make_shared<asio::steady_timer>(state->ioService, std::chrono::milliseconds(delayMillis));
+    state->pendingTimers.insert(timer);
+    timer->async_wait([state, timer, task](const asio::error_code &errorCode) {
+        {
+            std::lock_guard<std::mutex> timerGuard(state->lock);
+            state->pendingTimers.erase(timer);
+        }
+        if (!errorCode && !state->IsShutdown()) {
+            RunTask(task);
+        }
+    });
+}
+
+void TaskScheduler::Shutdown() {
+    {
+        std::lock_guard<std::mutex> guard(m_state->lock);
+        if (m_state->shutdown) {
+            return;
+        }
+        m_state->shutdown = true;
+        // Fire the pending timers now with operation_aborted, and let run() return once the
+        // remaining handlers have drained.
+        for (const std::shared_ptr<asio::steady_timer> &timer : m_state->pendingTimers) {
+            asio::error_code ignored;
+            timer->cancel(ignored);
+        }
+        m_state->work.reset();
+    }
+
+    if (m_workerThread && m_workerThread->joinable()) {
+        // A task may shut the SDK down (e.g. a completion handler calling Destroy()). The worker
+        // can't join itself, so let it finish the current task and exit on its own.
+        if (m_workerThread->get_id() == std::this_thread::get_id()) {
+            m_workerThread->detach();
+        } else {
+            m_workerThread->join();
+        }
+    }
+}
+
+void TaskScheduler::RunTask(const std::function<void()> &task) {
+    try {
+        task();
+    } catch (const std::exception &e) {
+        SPDLOG_ERROR("Exception thrown by scheduled task: {}", e.what());
+    } catch (...) {
+        SPDLOG_ERROR("Unknown exception thrown by scheduled task");
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
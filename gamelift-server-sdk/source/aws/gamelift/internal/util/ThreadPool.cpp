@@ -0,0 +1,85 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/ThreadPool.h>
+#include <spdlog/spdlog.h>
+#include <thread>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+ThreadPool::ThreadPool(int threadCount) : m_state(std::make_shared<SharedState>()) {
+    for (int i = 0; i < threadCount; ++i) {
+        std::shared_ptr<SharedState> state = m_state;
+        std::thread([state] { Run(state); }).detach();
+    }
+}
+
+ThreadPool::~ThreadPool() { Shutdown(); }
+
+void ThreadPool::Post(const std::function<void()> &task, const char *taskName) {
+    {
+        std::lock_guard<std::mutex> lock(m_state->lock);
+        if (m_state->shutdown) {
+            SPDLOG_WARN("Dropping {} callback posted after shutdown", taskName);
+            return;
+        }
+        Task queuedTask = {task, taskName};
+        m_state->tasks.push_back(queuedTask);
+    }
+    m_state->cond.notify_one();
+}
+
+void ThreadPool::Shutdown() {
+    std::deque<Task> droppedTasks;
+    {
+        std::lock_guard<std::mutex> lock(m_state->lock);
+        if (m_state->shutdown) {
+            return;
+        }
+        m_state->shutdown = true;
+        droppedTasks.swap(m_state->tasks);
+    }
+    m_state->cond.notify_all();
+    for (const Task &droppedTask : droppedTasks) {
+        SPDLOG_WARN("Dropping {} callback that had not started before shutdown", droppedTask.name);
+    }
+}
+
+void ThreadPool::Run(const std::shared_ptr<SharedState> &state) {
+    std::unique_lock<std::mutex> lock(state->lock);
+    while (true) {
+        state->cond.wait(lock, [&state] { return state->shutdown || !state->tasks.empty(); });
+        if (state->shutdown) {
+            return;
+        }
+        std::function<void()> task = std::move(state->tasks.front().run);
+        const char *taskName = state->tasks.front().name;
+        state->tasks.pop_front();
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception &e) {
+            SPDLOG_ERROR("Exception thrown by {} callback: {}", taskName, e.what());
+        } catch (...) {
+            SPDLOG_ERROR("Unknown exception thrown by {} callback", taskName);
+        }
+        // Destroy the task before re-acquiring the lock, its captures may post again.
+        task = nullptr;
+        lock.lock();
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -15,47 +15,59 @@
 #include <cassert>
 
 void Combiner::Add(MetricMessage message) {
+  MetricState &state = GetState(*message.Metric);
   if (message.IsGauge()) {
     // We have to do a bit more work for gauges to convert GaugeAdd to GaugeSet
-    UpdateGauge(message);
+    UpdateGauge(state, message);
   } else {
-    auto it = m_combinedMessages.find(message.Metric);
-    if (it == std::end(m_combinedMessages)) {
-      m_combinedMessages.emplace(message.Metric, message);
+    if (!state.IsCombined) {
+      SetCombined(state, message);
+      state.TimerSampleCount = 1;
       return;
     }
 
     assert(message.IsCounter() || message.IsTimer());
     if (message.IsCounter()) {
-      UpdateCounter(it->second, message);
+      UpdateCounter(state.Combined, message);
     } else if (message.IsTimer()) {
-      UpdateTimer(it->second, message);
+      UpdateTimer(state, message);
     }
   }
 }
 
-void Combiner::UpdateGauge(const MetricMessage &message) {
+Combiner::MetricState &Combiner::GetState(const IMetric &metric) {
+  const MetricId id = metric.GetId();
+  if (id >= m_metrics.size()) {
+    m_metrics.resize(id + 1);
+  }
+  return m_metrics[id];
+}
+
+void Combiner::SetCombined(MetricState &state, const MetricMessage &message) {
+  if (!state.IsCombined) {
+    state.IsCombined = true;
+    m_combinedIds.emplace_back(message.Metric->GetId());
+  }
+  state.Combined = message;
+}
+
+void Combiner::UpdateGauge(MetricState &state, const MetricMessage &message) {
   assert(message.Type == MetricMessageType::GaugeSet ||
          message.Type == MetricMessageType::GaugeAdd);
 
   if (message.Type == MetricMessageType::GaugeSet) {
     // If setting - we just use the new value
-    m_combinedMessages[message.Metric] = message;
-    m_gaugeHistory[message.Metric] = message;
+    SetCombined(state, message);
   } else if (message.Type == MetricMessageType::GaugeAdd) {
     // If adding - we get historic value (if available) and add to it
     //             if there's no historic value, we just add to 0
-    double currentValue = 0;
-    auto it = m_gaugeHistory.find(message.Metric);
-    if (it != std::end(m_gaugeHistory)) {
-      currentValue = it->second.SubmitDouble.Value;
-    }
-    currentValue += message.SubmitDouble.Value;
-
-    auto newMessage = MetricMessage::GaugeSet(*message.Metric, currentValue);
-    m_combinedMessages[message.Metric] = newMessage;
-    m_gaugeHistory[message.Metric] = newMessage;
+    const double currentValue =
+        (state.HasGaugeHistory ? state.GaugeHistory : 0) +
+        message.SubmitDouble.Value;
+    SetCombined(state, MetricMessage::GaugeSet(*message.Metric, currentValue));
   }
+  state.HasGaugeHistory = true;
+  state.GaugeHistory = state.Combined.SubmitDouble.Value;
 }
 
 void Combiner::UpdateCounter(MetricMessage &current,
@@ -66,23 +78,12 @@ void Combiner::UpdateCounter(MetricMessage &current,
   current.SubmitDouble.Value += newMessage.SubmitDouble.Value;
 }
 
-void Combiner::UpdateTimer(MetricMessage &current,
+void Combiner::UpdateTimer(MetricState &state,
                            const MetricMessage &newMessage) {
   assert(newMessage.Type == MetricMessageType::TimerSet);
 
-  // Grab or init sample count
-  auto sampleCountIt = m_timerSampleCount.find(current.Metric);
-  if (sampleCountIt != std::end(m_timerSampleCount)) {
-    ++(sampleCountIt->second);
-  } else {
-    // This is the second sample being added, hence we initialize it to 2.
-    auto pair = m_timerSampleCount.emplace(current.Metric, 2);
-
-    const bool insertSuccess = pair.second;
-    assert(insertSuccess);
-
-    sampleCountIt = pair.first;
-  }
+  MetricMessage &current = state.Combined;
+  ++state.TimerSampleCount;
 
   // Welford's algorithm
   //     numerically stable mean
@@ -92,11 +93,14 @@ void Combiner::UpdateTimer(MetricMessage &current,
   // https://nullbuffer.com/articles/welford_algorithm.html
   const double update =
       (newMessage.SubmitDouble.Value - current.SubmitDouble.Value) /
-      sampleCountIt->second;
+      state.TimerSampleCount;
   current.SubmitDouble.Value += update;
 }
 
 void Combiner::Clear() {
-  m_combinedMessages.clear();
-  m_timerSampleCount.clear();
+  for (MetricId id : m_combinedIds) {
+    m_metrics[id].IsCombined = false;
+    m_metrics[id].TimerSampleCount = 0;
+  }
+  m_combinedIds.clear();
 }
@@ -50,7 +50,7 @@ void CrashReporterClient::RegisterProcessWithRetries() {
     std::string requestUri = baseUrl + RegisterProcessUrlPath + "?" +
                              ProcessPidParameterName + "=" + std::to_string(processPid);
     
-    spdlog::info("Registering process with {} {} in OTEL Collector Crash Reporter", ProcessPidParameterName, processPid);
+    SPDLOG_INFO("Registering process with {} {} in OTEL Collector Crash Reporter", ProcessPidParameterName, processPid);
 
     // 5 retries, 1s base delay with jitter (default)
     // Total max wait time: ~1s + 2s + 4s + 8s + 16s = ~31s
@@ -60,21 +60,21 @@ void CrashReporterClient::RegisterProcessWithRetries() {
         try {
             auto response = httpClient->SendGetRequest(requestUri);
             if (response.IsSuccessfulStatusCode()) {
-                spdlog::info("Successfully registered {} {} to OTEL Collector Crash Reporter", ProcessPidParameterName, processPid);
+                SPDLOG_INFO("Successfully registered {} {} to OTEL Collector Crash Reporter", ProcessPidParameterName, processPid);
                 return true;
             } else {
-                spdlog::error("Failed to register {} {} to OTEL Collector Crash Reporter, Http response: {} - {}", 
+                SPDLOG_ERROR("Failed to register {} {} to OTEL Collector Crash Reporter, Http response: {} - {}", 
                              ProcessPidParameterName, processPid, response.statusCode, response.body);
                 return true; // Don't retry on HTTP errors (4xx, 5xx)
             }
         } catch (const std::exception& e) {
             std::string errorMsg = e.what();
             if (isRetryableError(errorMsg)) {
-                spdlog::warn("Failed to register {} {} to OTEL Collector Crash Reporter due to connection error: {}", 
+                SPDLOG_WARN("Failed to register {} {} to OTEL Collector Crash Reporter due to connection error: {}", 
                              ProcessPidParameterName, processPid, e.what());
                 return false; // Retry on connection errors
             } else {
-                spdlog::error("Failed to register {} {} to OTEL Collector Crash Reporter due to error: {}", 
+                SPDLOG_ERROR("Failed to register {} {} to OTEL Collector Crash Reporter due to error: {}", 
                              ProcessPidParameterName, processPid, e.what());
                 return true; // Don't retry on other errors
             }
@@ -103,16 +103,16 @@ void CrashReporterClient::TagGameSession(const std::string& sessionId) {
                              SessionIdParameterName + "=" + sessionId;
 
     try {
-        spdlog::info("Adding {} tag {} to process with {} {} to the OTEL Collector Crash Reporter",
+        SPDLOG_INFO("Adding {} tag {} to process with {} {} to the OTEL Collector Crash Reporter",
                      SessionIdParameterName, sessionId, ProcessPidParameterName, processPid);
         auto response = httpClient->SendGetRequest(requestUri);
         if (!response.IsSuccessfulStatusCode()) {
-            spdlog::error("Failed to add {} tag {} to process with {} {} in the OTEL Collector Crash Reporter, Http response: {} - {}",
+            SPDLOG_ERROR("Failed to add {} tag {} to process with {} {} in the OTEL Collector Crash Reporter, Http response: {} - {}",
                           SessionIdParameterName, sessionId, ProcessPidParameterName, processPid,
                           response.statusCode, response.body);
         }
     } catch (const std::exception& e) {
-        spdlog::error("Failed to add {} tag {} to process with {} {} in the OTEL Collector Crash Reporter due to error: {}",
+        SPDLOG_ERROR("Failed to add {} tag {} to process with {} {} in the OTEL Collector Crash Reporter due to error: {}",
                       SessionIdParameterName, sessionId, ProcessPidParameterName, processPid, e.what());
     }
 }
@@ -127,15 +127,15 @@ void CrashReporterClient::DeregisterProcess() {
                              ProcessPidParameterName + "=" + std::to_string(processPid);
 
     try {
-        spdlog::info("Unregistering process with {} {} in OTEL Collector Crash Reporter",
+        SPDLOG_INFO("Unregistering process with {} {} in OTEL Collector Crash Reporter",
                      ProcessPidParameterName, processPid);
         auto response = httpClient->SendGetRequest(requestUri);
         if (!response.IsSuccessfulStatusCode()) {
-            spdlog::error("Failed to deregister {} {} in the OTEL Collector Crash Reporter, Http response: {} - {}",
+            SPDLOG_ERROR("Failed to deregister {} {} in the OTEL Collector Crash Reporter, Http response: {} - {}",
                           ProcessPidParameterName, processPid, response.statusCode, response.body);
         }
     } catch (const std::exception& e) {
-        spdlog::error("Failed to deregister {} {} in the OTEL Collector Crash Reporter due to error: {}",
+        SPDLOG_ERROR("Failed to deregister {} {} in the OTEL Collector Crash Reporter due to error: {}",
                       ProcessPidParameterName, processPid, e.what());
     }
 }
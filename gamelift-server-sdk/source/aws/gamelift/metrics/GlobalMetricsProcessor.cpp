@@ -30,8 +30,7 @@
 GAMELIFT_METRICS_DEFINE_GAUGE(ServerUpGauge);
 
 namespace {
-std::unique_ptr<::Aws::GameLift::Metrics::IMetricsProcessor>
-    GlobalProcessor(nullptr);
+std::unique_ptr<MetricsProcessor> GlobalProcessor(nullptr);
 std::shared_ptr<::Aws::GameLift::Metrics::StatsDClient>
     GlobalStatsDClient(nullptr);
 std::shared_ptr<::Aws::GameLift::Metrics::CrashReporterClient>
@@ -117,6 +116,17 @@ void MetricsInitialize(const MetricsSettings &settings) {
         GAMELIFT_METRICS_LOG_ERROR("StatsDClient is not initialized. Cannot send metrics data.");
       }
     };
+
+    // The StatsD client batches packets until it's flushed.
+    MetricsSettings::PostProcessingFunc postProcessingCallback = settings.PostProcessingCallback;
+    settingsWithCallbackOverride.PostProcessingCallback = [postProcessingCallback]() mutable {
+      if (GlobalStatsDClient) {
+        GlobalStatsDClient->Flush();
+      }
+      if (postProcessingCallback) {
+        postProcessingCallback();
+      }
+    };
   }
 
   GlobalProcessor.reset(new MetricsProcessor(settingsWithCallbackOverride));
@@ -127,6 +137,12 @@ void MetricsInitialize(const MetricsSettings &settings) {
 }
 
 void MetricsTerminate() {
+  // Stop background flushing first, so the final server_up value of 0 can't be
+  // overtaken by the flush thread.
+  if (GlobalProcessor) {
+    GlobalProcessor->StopBackgroundFlush();
+  }
+
   GAMELIFT_METRICS_SET(ServerUpGauge, 0);
 
   // Process the final metrics before shutting down
@@ -0,0 +1,193 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/metrics/Histogram.h>
+
+#include <aws/gamelift/metrics/LoggerMacros.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Metrics {
+namespace {
+/**
+ * INTERNAL: concrete histogram metric implementation
+ */
+class HistogramImpl : public IDerivedMetric {
+public:
+  template <class It>
+  HistogramImpl(It begin, It end)
+      : m_bounds(begin, end), m_counts(m_bounds.size() + 1, 0),
+        m_bucketMetrics(m_bounds.size() + 1) {}
+
+  virtual void HandleMessage(MetricMessage &message,
+                             IMetricsEnqueuer &submitter) override {
+    switch (message.Type) {
+    case MetricMessageType::GaugeAdd:
+      m_currentValue += message.SubmitDouble.Value;
+      AddValue(m_currentValue);
+      break;
+    case MetricMessageType::GaugeSet:
+    case MetricMessageType::TimerSet:
+      m_currentValue = message.SubmitDouble.Value;
+      AddValue(m_currentValue);
+      break;
+    case MetricMessageType::TagSet:
+    case MetricMessageType::TagRemove:
+      for (auto &bucketMetric : m_bucketMetrics) {
+        CopyTagMessage(message, bucketMetric, submitter);
+      }
+      CopyTagMessage(message, m_sumMetric, submitter);
+      break;
+    default:
+      break;
+    }
+  }
+
+  virtual void EmitMetrics(const IMetric *originalMetric,
+                           IMetricsEnqueuer &submitter) override {
+    if (m_numSeenSinceLastEmitCall == 0) {
+      return;
+    }
+
+    if (!m_metricsInitialized) {
+      InitializeMetrics(originalMetric, submitter);
+    }
+
+    // Buckets are cumulative, so empty leading buckets are the only ones
+    // without an update.
+    uint64_t cumulativeCount = 0;
+    for (size_t i = 0; i < m_counts.size(); ++i) {
+      cumulativeCount += m_counts[i];
+      if (cumulativeCount > 0) {
+        submitter.Enqueue(MetricMessage::CounterAdd(
+            m_bucketMetrics[i], static_cast<double>(cumulativeCount)));
+      }
+    }
+    // A gauge, since counters at or below zero are not sent.
+    submitter.Enqueue(MetricMessage::GaugeSet(m_sumMetric, m_sum));
+
+    std::fill(std::begin(m_counts), std::end(m_counts), 0);
+    m_sum = 0;
+    m_numSeenSinceLastEmitCall = 0;
+  }
+
+private:
+  /**
+   * Formats a bound with the fewest digits that still read back as the same
+   * value, so that close bounds such as 1000000 and 1000001 get distinct tags.
+   * Whole numbers that fit in a double's digits are written without exponent.
+   */
+  static std::string FormatBound(double bound) {
+    const int maxPrecision = std::numeric_limits<double>::max_digits10;
+    const bool allowExponent = std::abs(bound) < 1 || std::abs(bound) >= 1e17;
+    std::ostringstream stream;
+    for (int precision = 6;; ++precision) {
+      stream.str("");
+      stream << std::setprecision(precision) << bound;
+      const std::string formatted = stream.str();
+      if (precision >= maxPrecision ||
+          (std::strtod(formatted.c_str(), nullptr) == bound &&
+           (allowExponent || formatted.find('e') == std::string::npos))) {
+        return formatted;
+      }
+    }
+  }
+
+  void AddValue(double value) {
+    const auto bucketIt =
+        std::lower_bound(std::begin(m_bounds), std::end(m_bounds), value);
+    ++m_counts[bucketIt - std::begin(m_bounds)];
+    m_sum += value;
+    ++m_numSeenSinceLastEmitCall;
+  }
+
+  void InitializeMetrics(const IMetric *originalMetric,
+                         IMetricsEnqueuer &submitter) {
+    const std::string bucketKey =
+        std::string(originalMetric->GetKey()) + ".bucket";
+    for (size_t i = 0; i < m_bucketMetrics.size(); ++i) {
+      DynamicMetric &bucketMetric = m_bucketMetrics[i];
+      bucketMetric.SetMetricType(MetricType::Counter);
+      bucketMetric.SetKey(bucketKey.c_str());
+
+      const std::string bound =
+          i < m_bounds.size() ? FormatBound(m_bounds[i]) : "+Inf";
+      submitter.Enqueue(
+          MetricMessage::TagSet(bucketMetric, "le", bound.c_str()));
+    }
+
+    const std::string sumKey = std::string(originalMetric->GetKey()) + ".sum";
+    m_sumMetric.SetMetricType(MetricType::Gauge);
+    m_sumMetric.SetKey(sumKey.c_str());
+
+    m_metricsInitialized = true;
+  }
+
+private:
+  std::vector<double> m_bounds;
+  // Per-bucket counts for the current capture period. The last bucket holds
+  // values above every bound.
+  std::vector<uint64_t> m_counts;
+  double m_sum = 0;
+  size_t m_numSeenSinceLastEmitCall = 0;
+  double m_currentValue = 0;
+
+  // Sized once, never reallocated: messages refer to these by address.
+  std::vector<DynamicMetric> m_bucketMetrics;
+  DynamicMetric m_sumMetric;
+  bool m_metricsInitialized = false;
+};
+
+/**
+ * INTERNAL: validate histogram bounds and report errors for debug builds
+ *
+ * @param begin The begin iterator of the sorted bounds
+ * @param end The past-the-end iterator of the sorted bounds
+ */
+template <class InputIt>
+inline void ValidateBounds(InputIt begin, InputIt end) {
+  if (begin == end) {
+    GAMELIFT_METRICS_LOG_CRITICAL("Histogram bounds list is empty.");
+  }
+
+  for (auto it = begin + 1; it < end; ++it) {
+    if (*(it - 1) == *it) {
+      GAMELIFT_METRICS_LOG_CRITICAL("Duplicate histogram bounds detected.",
+                                    *it);
+    }
+  }
+}
+} // anonymous namespace
+
+namespace Internal {
+HistogramWrapper HistogramWrapper::Create(double *begin, double *end) {
+  std::sort(begin, end);
+
+#ifndef NDEBUG
+  ValidateBounds(begin, end);
+#endif
+
+  return HistogramWrapper(new HistogramImpl(begin, end));
+}
+} // namespace Internal
+} // namespace Metrics
+} // namespace GameLift
+} // namespace Aws
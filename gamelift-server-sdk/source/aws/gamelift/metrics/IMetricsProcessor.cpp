@@ -13,12 +13,21 @@
 #include <aws/gamelift/metrics/IMetricsProcessor.h>
 #include <aws/gamelift/metrics/DynamicTag.h>
 
+#include <atomic>
+
 namespace Aws {
 namespace GameLift {
 namespace Metrics {
+namespace {
+// Starts at 1, so 0 never names a processor.
+std::atomic<uint64_t> NextProcessorId(1);
+} // namespace
 
 IMetricsEnqueuer::~IMetricsEnqueuer() {}
 
+IMetricsProcessor::IMetricsProcessor()
+    : m_processorId(NextProcessorId.fetch_add(1, std::memory_order_relaxed)) {}
+
 IMetricsProcessor::~IMetricsProcessor() {}
 
 #ifdef GAMELIFT_USE_STD
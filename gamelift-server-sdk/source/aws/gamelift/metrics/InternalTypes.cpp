@@ -12,9 +12,22 @@
  */
 #include <aws/gamelift/metrics/InternalTypes.h>
 
+#include <atomic>
+
+namespace {
+std::atomic<Aws::GameLift::Metrics::MetricId> NextMetricId(0);
+} // namespace
+
 namespace Aws {
 namespace GameLift {
 namespace Metrics {
+IMetric::IMetric() : IMetric(true) {}
+IMetric::IMetric(bool hasDerivedMetrics)
+    : m_id(NextMetricId.fetch_add(1, std::memory_order_relaxed)),
+      m_hasDerivedMetrics(hasDerivedMetrics) {}
+IMetric::IMetric(const IMetric &other)
+    : m_id(NextMetricId.fetch_add(1, std::memory_order_relaxed)),
+      m_hasDerivedMetrics(other.m_hasDerivedMetrics) {}
 IMetric::~IMetric() {}
 } // namespace Metrics
 } // namespace GameLift
@@ -0,0 +1,195 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/metrics/MetricFamily.h>
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Metrics {
+namespace {
+/**
+ * Non-owning string, so interned strings can be looked up without copying the
+ * string being looked up.
+ */
+struct StringRef {
+  const char *Data;
+  size_t Size;
+};
+
+struct StringRefHash {
+  size_t operator()(const StringRef &value) const {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < value.Size; ++i) {
+      hash ^= static_cast<unsigned char>(value.Data[i]);
+      hash *= 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+struct StringRefEqual {
+  bool operator()(const StringRef &a, const StringRef &b) const {
+    return a.Size == b.Size && std::memcmp(a.Data, b.Data, a.Size) == 0;
+  }
+};
+
+// Interned string ids of a label set, as key, value, key, value... sorted by
+// key.
+using LabelSetKey = std::vector<uint32_t>;
+
+struct LabelSetKeyHash {
+  size_t operator()(const LabelSetKey &key) const {
+    size_t hash = key.size();
+    for (uint32_t id : key) {
+      hash ^= id + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+  }
+};
+
+struct ChildNode {
+  // Interned label strings, as key, value, key, value...
+  std::vector<const char *> Labels;
+  LabeledMetric Metric;
+
+  ChildNode(IMetric &parent, std::vector<const char *> labels)
+      : Labels(std::move(labels)),
+        Metric(parent, Labels.data(), static_cast<int>(Labels.size() / 2)) {}
+};
+} // namespace
+
+void LabeledMetric::Submit(IMetricsProcessor &processor,
+                           MetricMessage message) {
+  const uint64_t processorId = processor.GetProcessorId();
+  if (m_taggedProcessorId.load(std::memory_order_acquire) != processorId) {
+    // Threads racing here may both enqueue the tags, which sets them twice to
+    // the same values.
+    for (int i = 0; i < m_labelCount; ++i) {
+      processor.Enqueue(
+          MetricMessage::TagSet(*this, GetLabelKey(i), GetLabelValue(i)));
+    }
+    m_taggedProcessorId.store(processorId, std::memory_order_release);
+  }
+  processor.Enqueue(message);
+}
+
+namespace Internal {
+class MetricFamilyImpl {
+public:
+  explicit MetricFamilyImpl(IMetric &parent) : m_parent(parent) {}
+
+  LabeledMetric &WithLabelArray(const char *const *labels, int labelCount) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_labelIds.clear();
+    for (int i = 0; i < labelCount; ++i) {
+      m_labelIds.emplace_back(Intern(labels[i * 2]),
+                              Intern(labels[i * 2 + 1]));
+    }
+    // Insertion sort by key: label sets are small, and this keeps "map, mode"
+    // and "mode, map" the same child.
+    for (size_t i = 1; i < m_labelIds.size(); ++i) {
+      for (size_t j = i; j > 0 && m_labelIds[j].first < m_labelIds[j - 1].first;
+           --j) {
+        std::swap(m_labelIds[j], m_labelIds[j - 1]);
+      }
+    }
+
+    m_lookupKey.clear();
+    for (const std::pair<uint32_t, uint32_t> &label : m_labelIds) {
+      m_lookupKey.emplace_back(label.first);
+      m_lookupKey.emplace_back(label.second);
+    }
+
+    auto it = m_children.find(m_lookupKey);
+    if (it != std::end(m_children)) {
+      return it->second->Metric;
+    }
+
+    std::vector<const char *> childLabels;
+    childLabels.reserve(m_lookupKey.size());
+    for (uint32_t id : m_lookupKey) {
+      childLabels.emplace_back(m_strings[id].c_str());
+    }
+    std::unique_ptr<ChildNode> child(
+        new ChildNode(m_parent, std::move(childLabels)));
+    LabeledMetric &metric = child->Metric;
+    m_children.emplace(m_lookupKey, std::move(child));
+    return metric;
+  }
+
+  size_t GetChildCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_children.size();
+  }
+
+private:
+  uint32_t Intern(const char *value) {
+    const StringRef ref{value, std::strlen(value)};
+    auto it = m_stringIds.find(ref);
+    if (it != std::end(m_stringIds)) {
+      return it->second;
+    }
+
+    // Deque elements never move, so the interned string can back the key.
+    const uint32_t id = static_cast<uint32_t>(m_strings.size());
+    m_strings.emplace_back(value, ref.Size);
+    const std::string &interned = m_strings.back();
+    m_stringIds.emplace(StringRef{interned.data(), interned.size()}, id);
+    return id;
+  }
+
+  IMetric &m_parent;
+  mutable std::mutex m_mutex;
+
+  // Indexed by interned string id.
+  std::deque<std::string> m_strings;
+  std::unordered_map<StringRef, uint32_t, StringRefHash, StringRefEqual>
+      m_stringIds;
+
+  std::unordered_map<LabelSetKey, std::unique_ptr<ChildNode>, LabelSetKeyHash>
+      m_children;
+
+  // Reused between lookups so that finding a known child allocates nothing.
+  std::vector<std::pair<uint32_t, uint32_t>> m_labelIds;
+  LabelSetKey m_lookupKey;
+};
+
+MetricFamilyBase::MetricFamilyBase(IMetric &parent)
+    : m_impl(new MetricFamilyImpl(parent)) {}
+
+MetricFamilyBase::~MetricFamilyBase() = default;
+
+LabeledMetric &MetricFamilyBase::WithLabelArray(const char *const *labels,
+                                                int labelCount) {
+  return m_impl->WithLabelArray(labels, labelCount);
+}
+
+size_t MetricFamilyBase::GetChildCount() const {
+  return m_impl->GetChildCount();
+}
+} // namespace Internal
+
+} // namespace Metrics
+} // namespace GameLift
+} // namespace Aws
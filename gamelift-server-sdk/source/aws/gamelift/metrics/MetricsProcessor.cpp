@@ -13,10 +13,213 @@
 #include <aws/gamelift/metrics/MetricsProcessor.h>
 #include <aws/gamelift/metrics/DerivedMetric.h>
 #include <aws/gamelift/metrics/GaugeMacros.h>
+#include <aws/gamelift/metrics/LoggerMacros.h>
+#include <aws/gamelift/metrics/Samplers.h>
+#include <algorithm>
 #include <iterator>
-#include <unordered_set>
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace {
+// Nice value for the flush thread, so it yields to game threads under load.
+static constexpr int FlushThreadNiceValue = 10;
+
+// Keeps a zero capture interval from spinning the flush thread.
+static constexpr std::chrono::milliseconds MinFlushThreadSleep(10);
+
+// Initial size of a queue without MaxQueuedMessages. It grows as needed.
+static constexpr size_t UnboundedQueueInitialCapacity = 1024;
+
+size_t ProducerTokenCount(
+    const Aws::GameLift::Metrics::MetricsSettings &settings) {
+  return settings.MaxProducerThreads > 0
+             ? static_cast<size_t>(settings.MaxProducerThreads)
+             : 0;
+}
+
+size_t MessageQueueMinCapacity(
+    const Aws::GameLift::Metrics::MetricsSettings &settings) {
+  return settings.MaxQueuedMessages > 0
+             ? static_cast<size_t>(settings.MaxQueuedMessages)
+             : UnboundedQueueInitialCapacity;
+}
+
+// Producer threads keep the queue blocks they have filled, so with a limit
+// the initial block pool must hold the whole limit for every producer slot.
+// The queue sizes it that way when told how many producers to expect.
+size_t PreallocatedProducerCount(
+    const Aws::GameLift::Metrics::MetricsSettings &settings) {
+  return settings.MaxQueuedMessages > 0 ? ProducerTokenCount(settings) : 0;
+}
+
+void LowerCurrentThreadPriority() {
+#ifdef __linux__
+  // On Linux, setpriority on a thread id only affects that thread.
+  const id_t threadId = static_cast<id_t>(syscall(SYS_gettid));
+  if (setpriority(PRIO_PROCESS, threadId, FlushThreadNiceValue) != 0) {
+    GAMELIFT_METRICS_LOG_WARN("Failed to lower metrics flush thread priority");
+  }
+#elif defined(_WIN32) || defined(_WIN64)
+  if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL)) {
+    GAMELIFT_METRICS_LOG_WARN("Failed to lower metrics flush thread priority");
+  }
+#endif
+}
+} // namespace
+
+MetricsProcessor::MetricsProcessor(
+    const Aws::GameLift::Metrics::MetricsSettings &settings)
+    : m_messageQueueMPSC(MessageQueueMinCapacity(settings),
+                         PreallocatedProducerCount(settings), 0),
+      m_claimedProducerTokens(0),
+      m_maxQueuedMessages(settings.MaxQueuedMessages > 0
+                              ? settings.MaxQueuedMessages
+                              : 0),
+      m_queuedMessageCount(0),
+      m_threadLocalAggregation(settings.ThreadLocalAggregation),
+      m_droppedMessageCount(0), m_sendPacket(settings.SendPacketCallback),
+      m_preProcessCallback(settings.PreProcessingCallback),
+      m_postProcessCallback(settings.PostProcessingCallback),
+      m_captureInterval(std::chrono::duration_cast<NativeDurationT>(
+          SecondsT(settings.CaptureIntervalSec))),
+      m_nextCaptureTime(ClockT::now() + m_captureInterval),
+      m_packet(settings.MaxPacketSizeBytes, settings.FloatPrecision) {
+  const size_t producerTokenCount = ProducerTokenCount(settings);
+  m_producerTokens.reserve(producerTokenCount);
+  for (size_t i = 0; i < producerTokenCount; ++i) {
+    m_producerTokens.emplace_back(m_messageQueueMPSC);
+  }
+
+  if (settings.BackgroundFlush) {
+    m_flushThread = std::thread(&MetricsProcessor::RunFlushThread, this,
+                                settings.FlushThreadStartCallback);
+  }
+}
+
+struct MetricsProcessor::ProducerThreadState {
+  uint64_t ProcessorId = 0;
+  moodycamel::ProducerToken *Token = nullptr;
+  std::shared_ptr<ThreadAggregator> Aggregator;
+};
+
+void MetricsProcessor::Enqueue(MetricMessage message) {
+  ProducerThreadState &threadState = GetProducerThreadState();
+  if (threadState.Aggregator && threadState.Aggregator->TryAdd(message)) {
+    return;
+  }
+
+  if (m_maxQueuedMessages > 0) {
+    // Tag messages own an allocation and are rare, so they may go over the
+    // limit rather than be dropped.
+    const int64_t queued =
+        m_queuedMessageCount.fetch_add(1, std::memory_order_relaxed);
+    if (queued >= m_maxQueuedMessages && !message.IsTag()) {
+      m_queuedMessageCount.fetch_sub(1, std::memory_order_relaxed);
+      m_droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  moodycamel::ProducerToken *token = threadState.Token;
+  const bool enqueued = token ? m_messageQueueMPSC.enqueue(*token, message)
+                              : m_messageQueueMPSC.enqueue(message);
+  if (!enqueued) {
+    // Out of memory.
+    if (m_maxQueuedMessages > 0) {
+      m_queuedMessageCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    m_droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+MetricsProcessor::ProducerThreadState &
+MetricsProcessor::GetProducerThreadState() {
+  static thread_local ProducerThreadState threadState;
+
+  // Ids, unlike addresses, tell this processor apart from one destroyed
+  // before it.
+  if (threadState.ProcessorId != GetProcessorId()) {
+    const size_t index =
+        m_claimedProducerTokens.fetch_add(1, std::memory_order_relaxed);
+    threadState.ProcessorId = GetProcessorId();
+    threadState.Token =
+        index < m_producerTokens.size() ? &m_producerTokens[index] : nullptr;
+
+    threadState.Aggregator.reset();
+    if (m_threadLocalAggregation) {
+      threadState.Aggregator = std::make_shared<ThreadAggregator>();
+      std::lock_guard<std::mutex> lock(m_threadAggregatorsMutex);
+      m_threadAggregators.emplace_back(threadState.Aggregator);
+    }
+  }
+  return threadState;
+}
+
+void MetricsProcessor::DrainThreadAggregators(
+    std::vector<MetricMessage> &messages) {
+  std::lock_guard<std::mutex> lock(m_threadAggregatorsMutex);
+  for (auto it = std::begin(m_threadAggregators);
+       it != std::end(m_threadAggregators);) {
+    (*it)->Drain(messages);
+
+    // Nothing else holds the aggregator once its thread has exited.
+    if (it->use_count() == 1) {
+      it = m_threadAggregators.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void MetricsProcessor::StopBackgroundFlush() {
+  if (m_flushThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopFlushThread = true;
+    }
+    m_flushThreadWakeup.notify_one();
+    m_flushThread.join();
+  }
+}
+
+void MetricsProcessor::RunFlushThread(
+    Aws::GameLift::Metrics::MetricsSettings::FlushThreadStartFunc
+        flushThreadStart) {
+  if (flushThreadStart) {
+    flushThreadStart();
+  } else {
+    LowerCurrentThreadPriority();
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    const TimeT wakeTime =
+        std::max(m_nextCaptureTime, ClockT::now() + MinFlushThreadSleep);
+    if (m_flushThreadWakeup.wait_until(lock, wakeTime,
+                                       [this] { return m_stopFlushThread; })) {
+      return;
+    }
+
+    lock.unlock();
+    // Same as ProcessMetrics. The flush thread belongs to this processor, so
+    // it enqueues onto it directly.
+    Enqueue(MetricMessage::GaugeSet(ServerUpGauge::Instance(), 1));
+    ProcessMetricsNow();
+    lock.lock();
+  }
+}
 
 void MetricsProcessor::ProcessMetrics() {
+  if (IsBackgroundFlush()) {
+    // The flush thread takes care of it.
+    return;
+  }
+
   const auto now = ClockT::now();
   if (now < m_nextCaptureTime) {
     return;
@@ -34,88 +237,120 @@ void MetricsProcessor::ProcessMetricsNow() {
     m_preProcessCallback();
   }
 
+  std::lock_guard<std::mutex> processLock(m_processMutex);
+  UpdateCaptureGlobalTags();
+
+  const uint64_t droppedMessageCount = GetDroppedMessageCount();
+  if (droppedMessageCount != m_reportedDroppedMessageCount) {
+    GAMELIFT_METRICS_LOG_WARN(
+        "Metrics queue was full, dropped {} messages ({} since start)",
+        droppedMessageCount - m_reportedDroppedMessageCount,
+        droppedMessageCount);
+    m_reportedDroppedMessageCount = droppedMessageCount;
+  }
+
   const auto messageCount = m_messageQueueMPSC.size_approx();
-  m_messageQueueMPSC.try_dequeue_bulk(std::back_inserter(m_processQueue),
-                                      messageCount);
+  const size_t dequeuedCount = m_messageQueueMPSC.try_dequeue_bulk(
+      std::back_inserter(m_processQueue), messageCount);
+  if (m_maxQueuedMessages > 0) {
+    m_queuedMessageCount.fetch_sub(static_cast<int64_t>(dequeuedCount),
+                                   std::memory_order_relaxed);
+  }
+  DrainThreadAggregators(m_processQueue);
 
   m_combinedMetrics.Clear();
   ProcessMessages(m_processQueue);
   m_processQueue.clear();
   m_enqueuer.Clear();
 
+  // Only now that this capture is written with the sample rates its samples
+  // were taken at may adaptive samplers change their rates.
+  Aws::GameLift::Metrics::Internal::AdvanceSamplerInterval();
+
+  if (m_postProcessCallback) {
+    m_postProcessCallback();
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_nextCaptureTime = ClockT::now() + m_captureInterval;
 }
 
-namespace {
-void UpdateDerivedMetrics(std::vector<MetricMessage> &messages,
-                          IMetricsEnqueuer &enqueuer) {
-  for (auto &message : messages) {
-    struct HandleMessageVisitor final
-        : public Aws::GameLift::Metrics::IDerivedMetricVisitor {
-      MetricMessage &m_message;
-      IMetricsEnqueuer &m_enqueuer;
-
-      explicit HandleMessageVisitor(MetricMessage &message,
-                                    IMetricsEnqueuer &enqueuer) noexcept
-          : m_message(message), m_enqueuer(enqueuer) {}
-
-      virtual void VisitDerivedMetric(
-          Aws::GameLift::Metrics::IDerivedMetric &metric) override {
-        metric.HandleMessage(m_message, m_enqueuer);
-      }
-    };
+void MetricsProcessor::UpdateDerivedMetrics(
+    std::vector<MetricMessage> &messages) {
+  struct HandleMessageVisitor final
+      : public Aws::GameLift::Metrics::IDerivedMetricVisitor {
+    MetricMessage *m_message = nullptr;
+    IMetricsEnqueuer &m_enqueuer;
 
-    HandleMessageVisitor visitor(message, enqueuer);
-    message.Metric->GetDerivedMetrics().Visit(visitor);
-  }
-}
+    explicit HandleMessageVisitor(IMetricsEnqueuer &enqueuer) noexcept
+        : m_enqueuer(enqueuer) {}
 
-void SubmitDerivedMetrics(std::vector<MetricMessage> &messages,
-                          IMetricsEnqueuer &enqueuer) {
-  std::unordered_set<const Aws::GameLift::Metrics::IMetric *> submittedMetrics;
+    virtual void VisitDerivedMetric(
+        Aws::GameLift::Metrics::IDerivedMetric &metric) override {
+      metric.HandleMessage(*m_message, m_enqueuer);
+    }
+  };
 
+  HandleMessageVisitor visitor(m_enqueuer);
   for (auto &message : messages) {
-    const bool derivativeMetricsSubmitted =
-        submittedMetrics.find(message.Metric) != std::end(submittedMetrics);
-    if (derivativeMetricsSubmitted) {
+    if (!message.Metric->HasDerivedMetrics()) {
       continue;
     }
 
-    submittedMetrics.emplace(message.Metric);
+    visitor.m_message = &message;
+    message.Metric->GetDerivedMetrics().Visit(visitor);
+
+    const MetricId id = message.Metric->GetId();
+    if (id >= m_isDerivedMetricPending.size()) {
+      m_isDerivedMetricPending.resize(id + 1, false);
+    }
+    if (!m_isDerivedMetricPending[id]) {
+      m_isDerivedMetricPending[id] = true;
+      m_pendingDerivedMetrics.emplace_back(message.Metric);
+    }
+  }
+}
+
+void MetricsProcessor::SubmitDerivedMetrics() {
+  class EmitMessageVisitor final
+      : public Aws::GameLift::Metrics::IDerivedMetricVisitor {
+  public:
+    explicit EmitMessageVisitor(IMetricsEnqueuer &enqueuer) noexcept
+        : m_enqueuer(enqueuer) {}
 
-    class EmitMessageVisitor final
-        : public Aws::GameLift::Metrics::IDerivedMetricVisitor {
-    public:
-      EmitMessageVisitor(const Aws::GameLift::Metrics::IMetric *originalMetric,
-                         IMetricsEnqueuer &enqueuer) noexcept
-          : m_originalMetric(originalMetric), m_enqueuer(enqueuer) {}
+    virtual void VisitDerivedMetric(
+        Aws::GameLift::Metrics::IDerivedMetric &metric) override {
+      metric.EmitMetrics(m_originalMetric, m_enqueuer);
+    }
 
-      virtual void VisitDerivedMetric(
-          Aws::GameLift::Metrics::IDerivedMetric &metric) override {
-        metric.EmitMetrics(m_originalMetric, m_enqueuer);
-      }
+    const Aws::GameLift::Metrics::IMetric *m_originalMetric = nullptr;
 
-    private:
-      const Aws::GameLift::Metrics::IMetric *m_originalMetric;
-      IMetricsEnqueuer &m_enqueuer;
-    };
+  private:
+    IMetricsEnqueuer &m_enqueuer;
+  };
 
-    EmitMessageVisitor visitor(message.Metric, enqueuer);
-    message.Metric->GetDerivedMetrics().Visit(visitor);
+  EmitMessageVisitor visitor(m_enqueuer);
+  for (IMetric *metric : m_pendingDerivedMetrics) {
+    visitor.m_originalMetric = metric;
+    metric->GetDerivedMetrics().Visit(visitor);
+    m_isDerivedMetricPending[metric->GetId()] = false;
   }
+  m_pendingDerivedMetrics.clear();
 }
-} // namespace
 
 void MetricsProcessor::ProcessMessages(std::vector<MetricMessage> &messages) {
   // Compute derived metrics and appends their messages to the end
-  UpdateDerivedMetrics(messages, m_enqueuer);
-  SubmitDerivedMetrics(messages, m_enqueuer);
+  UpdateDerivedMetrics(messages);
+  SubmitDerivedMetrics();
   std::copy(std::begin(m_enqueuer.m_messages), std::end(m_enqueuer.m_messages),
             std::back_inserter(messages));
 
   // Combine all the metrics
   for (auto &message : messages) {
     if (message.IsTag()) {
+      if (message.Metric->GetId() < m_tagSuffixes.size()) {
+        m_tagSuffixes[message.Metric->GetId()].IsRendered = false;
+      }
       m_metricTags.Handle(message);
     } else {
       m_combinedMetrics.Add(message);
@@ -128,12 +363,41 @@ void MetricsProcessor::ProcessMessages(std::vector<MetricMessage> &messages) {
 
   // Build & send packets
   for (const auto &message : m_combinedMetrics) {
-    m_packet.Append(message, m_globalTags, m_metricTags.GetTags(message.Metric),
-                    m_sendPacket);
+    m_packet.Append(message, GetTagSuffix(message.Metric), m_sendPacket);
   }
   m_packet.Flush(m_sendPacket);
 }
 
+const std::string &MetricsProcessor::GetTagSuffix(const IMetric *metric) {
+  const MetricId id = metric->GetId();
+  if (id >= m_tagSuffixes.size()) {
+    m_tagSuffixes.resize(id + 1);
+  }
+
+  CachedTagSuffix &cached = m_tagSuffixes[id];
+  if (!cached.IsRendered) {
+    cached.Suffix =
+        RenderTagSuffix(m_captureGlobalTags, m_metricTags.GetTags(metric));
+    cached.IsRendered = true;
+  }
+  return cached.Suffix;
+}
+
+void MetricsProcessor::ClearTagSuffixes() {
+  for (CachedTagSuffix &cached : m_tagSuffixes) {
+    cached.IsRendered = false;
+  }
+}
+
+void MetricsProcessor::UpdateCaptureGlobalTags() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_globalTagsChanged) {
+    m_captureGlobalTags = m_globalTags;
+    m_globalTagsChanged = false;
+    ClearTagSuffixes();
+  }
+}
+
 void MetricsProcessor::OnStartGameSession(
     const Aws::GameLift::Server::Model::GameSession &session) {
 #ifdef GAMELIFT_USE_STD
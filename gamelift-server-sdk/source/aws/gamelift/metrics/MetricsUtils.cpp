@@ -37,37 +37,37 @@ MetricsParameters CreateMetricsParametersFromEnvironmentOrDefault() {
     const char* envStatsdHost = std::getenv(ENV_VAR_STATSD_HOST);
     if (envStatsdHost && envStatsdHost[0] != '\0') {
         statsdHost = envStatsdHost;
-        spdlog::info("Env override for statsdHost: {}", statsdHost);
+        SPDLOG_INFO("Env override for statsdHost: {}", statsdHost);
     }
 
     const char* envStatsdPort = std::getenv(ENV_VAR_STATSD_PORT);
     if (envStatsdPort && envStatsdPort[0] != '\0') {
         statsdPort = std::atoi(envStatsdPort);
-        spdlog::info("Env override for statsdPort: {}", statsdPort);
+        SPDLOG_INFO("Env override for statsdPort: {}", statsdPort);
     }
 
     const char* envCrashReporterHost = std::getenv(ENV_VAR_CRASH_REPORTER_HOST);
     if (envCrashReporterHost && envCrashReporterHost[0] != '\0') {
         crashReporterHost = envCrashReporterHost;
-        spdlog::info("Env override for crashReporterHost: {}", crashReporterHost);
+        SPDLOG_INFO("Env override for crashReporterHost: {}", crashReporterHost);
     }
 
     const char* envCrashReporterPort = std::getenv(ENV_VAR_CRASH_REPORTER_PORT);
     if (envCrashReporterPort && envCrashReporterPort[0] != '\0') {
         crashReporterPort = std::atoi(envCrashReporterPort);
-        spdlog::info("Env override for crashReporterPort: {}", crashReporterPort);
+        SPDLOG_INFO("Env override for crashReporterPort: {}", crashReporterPort);
     }
 
     const char* envFlushInterval = std::getenv(ENV_VAR_FLUSH_INTERVAL_MS);
     if (envFlushInterval && envFlushInterval[0] != '\0') {
         flushIntervalMs = std::atoi(envFlushInterval);
-        spdlog::info("Env override for flushIntervalMs: {}", flushIntervalMs);
+        SPDLOG_INFO("Env override for flushIntervalMs: {}", flushIntervalMs);
     }
 
     const char* envMaxPacketSize = std::getenv(ENV_VAR_MAX_PACKET_SIZE);
     if (envMaxPacketSize && envMaxPacketSize[0] != '\0') {
         maxPacketSize = std::atoi(envMaxPacketSize);
-        spdlog::info("Env override for maxPacketSize: {}", maxPacketSize);
+        SPDLOG_INFO("Env override for maxPacketSize: {}", maxPacketSize);
     }
 
 #ifdef GAMELIFT_USE_STD
@@ -85,6 +85,7 @@ MetricsSettings FromMetricsParameters(const Aws::GameLift::Server::MetricsParame
     settings.CrashReporterPort = params.GetCrashReporterPort();
     settings.MaxPacketSizeBytes = params.GetMaxPacketSize();
     settings.CaptureIntervalSec = params.GetFlushIntervalMs() / 1000.0f;
+    settings.BackgroundFlush = params.GetBackgroundFlush();
     return settings;
 }
 
@@ -13,116 +13,199 @@
 #include <aws/gamelift/metrics/PacketBuilder.h>
 #include <aws/gamelift/metrics/Samplers.h>
 #include <aws/gamelift/metrics/LoggerMacros.h>
+#include <algorithm>
 #include <cmath>
-#include <iomanip>
-#include <iostream>
-#include <spdlog/sinks/stdout_color_sinks.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
 
 namespace {
 static constexpr int NullTerminator = 1;
-}
 
-PacketBuilder::PacketBuilder(size_t packetSize, int floatPrecision)
-    : m_packetSize(packetSize), m_floatPrecision(floatPrecision) {
-  m_formatBuffer << std::setprecision(floatPrecision)
-                 << std::setiosflags(std::ios_base::fixed);
-}
-
-void PacketBuilder::Append(
-    const MetricMessage &message, const TagMap &globalTags,
-    const TagMap &metricTags,
-    Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc) {
-  const auto startPosition = m_formatBuffer.tellp();
-  AppendToStream(message, m_floatPrecision, globalTags, metricTags,
-                 m_formatBuffer);
-  const auto endPosition = m_formatBuffer.tellp();
+/*
+ * Values are formatted by scaling them to an integer number of 10^-precision
+ * units, which is exact as long as the scaled value stays below 2^53. Anything
+ * else falls back to snprintf.
+ */
+static constexpr int MaxFastPrecision = 15;
+static constexpr double MaxFastScaledValue = 9007199254740992.0; // 2^53
+static const double PowersOf10[MaxFastPrecision + 1] = {
+    1e0, 1e1, 1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+static const uint64_t IntegerPowersOf10[MaxFastPrecision + 1] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL};
 
-  const size_t messageLength = endPosition - startPosition;
-  if (messageLength > GetPacketSize() - NullTerminator) {
-    // If there's no way a message can fit the packet size, we drop it and log
-    // an error.
+/**
+ * @brief Writes text into a fixed-size buffer.
+ *
+ * Once something doesn't fit the writer stops writing but keeps counting, so
+ * the caller still learns how long the text would have been.
+ */
+class BufferWriter {
+public:
+  BufferWriter(char *buffer, size_t capacity)
+      : m_buffer(buffer), m_capacity(capacity), m_length(0) {}
 
-    try {
-      // Use a simple message that doesn't reference message.Metric
-      // which could be null in tests
-      GAMELIFT_METRICS_LOG_WARN(
-          "Message length ({}) exceeds packet size ({}), message has "
-          "been dropped.",
-          messageLength, GetPacketSize() - NullTerminator);
-    } catch (...) {
-      // Silently continue if logging fails - don't break tests
+  void Write(char c) {
+    if (m_length < m_capacity) {
+      m_buffer[m_length] = c;
     }
+    ++m_length;
+  }
 
-    // Reset the stream to the start position so we can continue appending
-    m_formatBuffer.seekp(startPosition);
-    return;
+  void Write(const char *text, size_t length) {
+    if (m_length + length <= m_capacity) {
+      std::memcpy(m_buffer + m_length, text, length);
+    }
+    m_length += length;
   }
 
-  const size_t formatBufferLength = endPosition;
-  if (formatBufferLength > GetPacketSize() - NullTerminator) {
-    // Likely case:
-    //     this message caused us to exceed packet size
-    //
-    //     1. Seek back to the end of the previous message (cut the new message
-    //     out of the stream).
-    //     2. Flush (sending packet).
-    //     3. Re-append the message to the (now) empty stream.
-    m_formatBuffer.seekp(startPosition);
-    Flush(sendPacketFunc);
-    AppendToStream(message, m_floatPrecision, globalTags, metricTags,
-                   m_formatBuffer);
-  } else if (formatBufferLength == GetPacketSize() - NullTerminator) {
-    // Unlikely case:
-    //      we hit the packet size exactly
-    //      so we can just flush
-    Flush(sendPacketFunc);
+  void Write(const char *text) { Write(text, std::strlen(text)); }
+
+  void Write(const std::string &text) { Write(text.data(), text.size()); }
+
+  size_t Length() const { return m_length; }
+
+private:
+  char *m_buffer;
+  size_t m_capacity;
+  size_t m_length;
+};
+
+void WriteDigits(uint64_t value, int minDigits, BufferWriter &writer) {
+  char digits[20];
+  int count = 0;
+  do {
+    digits[count++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  for (; count < minDigits; ++count) {
+    digits[count] = '0';
+  }
+  while (count > 0) {
+    writer.Write(digits[--count]);
   }
 }
 
-void PacketBuilder::Flush(
-    Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc) {
-  m_sendBuffer = m_formatBuffer.str();
-  m_sendBuffer.resize(m_formatBuffer.tellp());
-
-  sendPacketFunc(m_sendBuffer.c_str(),
-                 static_cast<int>(m_sendBuffer.size() + NullTerminator));
+void WriteInteger(int64_t value, bool showPositiveSign, BufferWriter &writer) {
+  uint64_t magnitude = static_cast<uint64_t>(value);
+  if (value < 0) {
+    writer.Write('-');
+    magnitude = 0 - magnitude;
+  } else if (showPositiveSign) {
+    writer.Write('+');
+  }
+  WriteDigits(magnitude, 1, writer);
+}
 
-  m_formatBuffer.seekp(0);
+void WriteFixedWithSnprintf(double value, int precision, bool showPositiveSign,
+                            BufferWriter &writer) {
+  const char *format = showPositiveSign ? "%+.*f" : "%.*f";
+  const int length = std::snprintf(nullptr, 0, format, precision, value);
+  if (length <= 0) {
+    return;
+  }
+  std::string text(static_cast<size_t>(length) + NullTerminator, '\0');
+  std::snprintf(&text[0], text.size(), format, precision, value);
+  text.resize(static_cast<size_t>(length));
+  // snprintf uses the decimal point of the C locale, StatsD always wants '.'
+  for (char &c : text) {
+    if (c != '-' && c != '+' && (c < '0' || c > '9')) {
+      c = '.';
+    }
+  }
+  writer.Write(text);
 }
 
-namespace {
-void WriteTags(const PacketBuilder::TagMap &tags, std::ostream &stream) {
-  if (tags.size() == 0) {
+/**
+ * @brief Writes the value with exactly `precision` digits after the decimal
+ * point, the same as printf("%.*f") in the "C" locale.
+ */
+void WriteFixed(double value, int precision, bool showPositiveSign,
+                BufferWriter &writer) {
+  if (std::isnan(value)) {
+    writer.Write("nan");
+    return;
+  }
+  if (std::isinf(value)) {
+    writer.Write(value < 0 ? "-inf" : (showPositiveSign ? "+inf" : "inf"));
     return;
   }
 
-  auto it = std::begin(tags);
-  stream << it->first << ':' << it->second;
-  for (++it; it != std::end(tags); ++it) {
-    stream << ',' << it->first << ':' << it->second;
+  if (precision >= 0 && precision <= MaxFastPrecision) {
+    const double scaled = std::fabs(value) * PowersOf10[precision];
+    if (scaled < MaxFastScaledValue) {
+      const double integral = std::floor(scaled);
+      const double fraction = scaled - integral;
+      /*
+       * The scaled value can be off from the exact decimal product by an ulp.
+       * That only changes the result when the fraction is right at the
+       * rounding boundary, so leave those (and exact ties, whose rounding
+       * mode is up to the C library) to snprintf.
+       */
+      if (std::fabs(fraction - 0.5) > scaled * 4.5e-16) {
+        const uint64_t units =
+            static_cast<uint64_t>(integral) + (fraction > 0.5 ? 1 : 0);
+        if (std::signbit(value)) {
+          writer.Write('-');
+        } else if (showPositiveSign) {
+          writer.Write('+');
+        }
+        WriteDigits(units / IntegerPowersOf10[precision], 1, writer);
+        if (precision > 0) {
+          writer.Write('.');
+          WriteDigits(units % IntegerPowersOf10[precision], precision, writer);
+        }
+        return;
+      }
+    }
   }
+
+  WriteFixedWithSnprintf(value, precision, showPositiveSign, writer);
 }
 
-void WriteTags(const PacketBuilder::TagMap &globalTags,
-               const PacketBuilder::TagMap &metricTags, std::ostream &stream) {
-  if (globalTags.size() > 0 || metricTags.size() > 0) {
-    stream << "|#";
-    WriteTags(globalTags, stream);
-    if (globalTags.size() > 0 && metricTags.size() > 0) {
-      stream << ',';
+void AppendTags(const PacketBuilder::TagMap &tags, std::string &suffix) {
+  for (const auto &tag : tags) {
+    if (suffix.size() > 2) {
+      suffix += ',';
     }
-    WriteTags(metricTags, stream);
+    suffix += tag.first;
+    suffix += ':';
+    suffix += tag.second;
   }
 }
 
-void WriteValue(double value, int floatPrecision, std::ostream &stream) {
+void WriteValue(double value, int floatPrecision, bool showPositiveSign,
+                BufferWriter &writer) {
+  if (!std::isfinite(value) || std::fabs(value) >= 9.2e18) {
+    // Doesn't fit an int64_t, can't have a printable fractional part anyway.
+    WriteFixed(value, floatPrecision, showPositiveSign, writer);
+    return;
+  }
+
   const auto valueAsInteger = static_cast<int64_t>(value);
   const double fractionalPart = value - valueAsInteger;
 
   /*
    * We check if the fractional part of our value is 0 when rounded for display.
    *
-   * We configured ostream to round to a specific float precision earlier.
+   * Values are rounded to a specific float precision.
    * Ie with a precision = 2, 1.425 becomes 1.43
    *
    * Due to floating point imprecision, we may, at some point, end up with a
@@ -130,7 +213,7 @@ void WriteValue(double value, int floatPrecision, std::ostream &stream) {
    * as before) and we'd prefer to print it as an integer.
    *
    * The check is simple: we multiply the fraction by 10^precision and see if
-   * when rounded the value equals to 0.
+   * when rounded the value equals to 0, ie if its magnitude is below 0.5.
    *
    * 0.425 * 10^2 = 42.5 ~= 43           => not zero so we print 1.425 as a real
    * 0.0000002 * 10^2 = 0.00002 ~= 0     => zero so we can print 1.0000002 as an
@@ -139,17 +222,48 @@ void WriteValue(double value, int floatPrecision, std::ostream &stream) {
    * This also takes care of integer valued doubles in general. (Fractional part
    * is already zero in that case.)
    */
-  const double thousandths = std::pow(10, floatPrecision);
-  const bool hasFractionalPart = std::round(fractionalPart * thousandths) != 0;
+  const double scale = floatPrecision >= 0 && floatPrecision <= MaxFastPrecision
+                           ? PowersOf10[floatPrecision]
+                           : std::pow(10, floatPrecision);
+  const bool hasFractionalPart = std::fabs(fractionalPart * scale) >= 0.5;
 
   if (hasFractionalPart) {
-    stream << value;
+    WriteFixed(value, floatPrecision, showPositiveSign, writer);
   } else {
-    stream << valueAsInteger;
+    WriteInteger(valueAsInteger, showPositiveSign, writer);
+  }
+}
+
+/**
+ * @brief Writes a sample rate in (0, 1) with six significant digits and no
+ * trailing zeros, eg 0.5 or 0.0125.
+ */
+void WriteRate(float rate, BufferWriter &writer) {
+  if (!(rate > 0.0f)) {
+    writer.Write('0');
+    return;
+  }
+
+  int precision = 6;
+  for (double bound = 0.1; rate < bound && precision < MaxFastPrecision;
+       bound /= 10) {
+    ++precision;
+  }
+
+  char digits[32];
+  BufferWriter digitsWriter(digits, sizeof(digits));
+  WriteFixed(rate, precision, false, digitsWriter);
+  size_t length = std::min(digitsWriter.Length(), sizeof(digits));
+  while (length > 0 && digits[length - 1] == '0') {
+    --length;
+  }
+  if (length > 0 && digits[length - 1] == '.') {
+    --length;
   }
+  writer.Write(digits, length);
 }
 
-void WriteSampleRate(const MetricMessage &message, std::ostream &stream) {
+void WriteSampleRate(const MetricMessage &message, BufferWriter &writer) {
   // Get the sample rate from the sampler
   if (message.Metric) {
     Aws::GameLift::Metrics::ISampler &sampler = message.Metric->GetSampler();
@@ -158,45 +272,37 @@ void WriteSampleRate(const MetricMessage &message, std::ostream &stream) {
     // Only add sample rate if it's less than 1.0 (1.0 is implicit/default in
     // StatsD). Packets with a 0.0 sample rate are not sent.
     if (rate < 1.0f) {
-      // Format using a separate stringstream with default formatting
-      std::ostringstream rateStream;
-      rateStream << rate;
-
-      stream << "|@" << rateStream.str();
+      writer.Write("|@", 2);
+      WriteRate(rate, writer);
     }
   }
 }
 
 void WriteMessage(const MetricMessage &message, int floatPrecision,
-                  std::ostream &stream) {
-  static constexpr auto showPositiveSign = std::ios_base::showpos;
-
-  stream << message.Metric->GetKey() << ':';
+                  BufferWriter &writer) {
+  writer.Write(message.Metric->GetKey());
+  writer.Write(':');
 
   if (message.Type == MetricMessageType::GaugeSet) {
-    WriteValue(message.SubmitDouble.Value, floatPrecision, stream);
-    stream << "|g";
+    WriteValue(message.SubmitDouble.Value, floatPrecision, false, writer);
+    writer.Write("|g", 2);
   } else if (message.Type == MetricMessageType::GaugeAdd) {
-    stream << std::setiosflags(showPositiveSign);
-    WriteValue(message.SubmitDouble.Value, floatPrecision, stream);
-    stream << "|g" << std::resetiosflags(showPositiveSign);
+    WriteValue(message.SubmitDouble.Value, floatPrecision, true, writer);
+    writer.Write("|g", 2);
   } else if (message.Type == MetricMessageType::CounterAdd) {
-    WriteValue(message.SubmitDouble.Value, floatPrecision, stream);
-    stream << "|c" << std::resetiosflags(showPositiveSign);
+    WriteValue(message.SubmitDouble.Value, floatPrecision, false, writer);
+    writer.Write("|c", 2);
   } else if (message.Type == MetricMessageType::TimerSet) {
-    WriteValue(message.SubmitDouble.Value, floatPrecision, stream);
-    stream << "|ms";
+    WriteValue(message.SubmitDouble.Value, floatPrecision, false, writer);
+    writer.Write("|ms", 3);
   }
 
   // Add sample rate if using SampleFraction
-  WriteSampleRate(message, stream);
+  WriteSampleRate(message, writer);
 }
-} // namespace
 
-void AppendToStream(const MetricMessage &message, int floatPrecision,
-                    const PacketBuilder::TagMap &globalTags,
-                    const PacketBuilder::TagMap &metricTags,
-                    std::ostream &stream) {
+void WriteLines(const MetricMessage &message, int floatPrecision,
+                const std::string &tagSuffix, BufferWriter &writer) {
   if (message.Type == MetricMessageType::GaugeSet &&
       message.SubmitDouble.Value < 0) {
     /*
@@ -212,19 +318,121 @@ void AppendToStream(const MetricMessage &message, int floatPrecision,
     https://github.com/statsd/statsd/blob/master/docs/metric_types.md#gauges
     */
     WriteMessage(MetricMessage::GaugeSet(*message.Metric, 0), floatPrecision,
-                 stream);
-    WriteTags(globalTags, metricTags, stream);
-    stream << '\n';
+                 writer);
+    writer.Write(tagSuffix);
+    writer.Write('\n');
     WriteMessage(
         MetricMessage::GaugeAdd(*message.Metric, message.SubmitDouble.Value),
-        floatPrecision, stream);
-    WriteTags(globalTags, metricTags, stream);
-    stream << '\n';
+        floatPrecision, writer);
+    writer.Write(tagSuffix);
+    writer.Write('\n');
   } else if (message.IsCounter() && message.SubmitDouble.Value <= 0) {
     // Skip non-positive or negative counters
   } else {
-    WriteMessage(message, floatPrecision, stream);
-    WriteTags(globalTags, metricTags, stream);
-    stream << '\n';
+    WriteMessage(message, floatPrecision, writer);
+    writer.Write(tagSuffix);
+    writer.Write('\n');
   }
 }
+} // namespace
+
+PacketBuilder::PacketBuilder(size_t packetSize, int floatPrecision)
+    : m_packetSize(packetSize), m_floatPrecision(floatPrecision),
+      m_packetBuffer(std::max<size_t>(packetSize, NullTerminator)) {}
+
+void PacketBuilder::Append(
+    const MetricMessage &message, const TagMap &globalTags,
+    const TagMap &metricTags,
+    Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc) {
+  Append(message, RenderTagSuffix(globalTags, metricTags), sendPacketFunc);
+}
+
+void PacketBuilder::Append(
+    const MetricMessage &message, const std::string &tagSuffix,
+    Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc) {
+  const size_t capacity = GetPacketSize() - NullTerminator;
+  const size_t remaining =
+      capacity > m_packetLength ? capacity - m_packetLength : 0;
+
+  // Format straight into the packet. If the message doesn't fit, the writer
+  // still tells us how long it is.
+  BufferWriter writer(m_packetBuffer.data() + m_packetLength, remaining);
+  WriteLines(message, m_floatPrecision, tagSuffix, writer);
+  const size_t messageLength = writer.Length();
+
+  if (messageLength > capacity) {
+    // If there's no way a message can fit the packet size, we drop it and log
+    // an error.
+
+    try {
+      // Use a simple message that doesn't reference message.Metric
+      // which could be null in tests
+      GAMELIFT_METRICS_LOG_WARN(
+          "Message length ({}) exceeds packet size ({}), message has "
+          "been dropped.",
+          messageLength, capacity);
+    } catch (...) {
+      // Silently continue if logging fails - don't break tests
+    }
+    return;
+  }
+
+  if (messageLength > remaining) {
+    // Likely case:
+    //     this message caused us to exceed packet size
+    //
+    //     1. Flush the messages before it (sending packet).
+    //     2. Write the message again at the start of the (now) empty packet.
+    Flush(sendPacketFunc);
+    BufferWriter emptyPacketWriter(m_packetBuffer.data(), capacity);
+    WriteLines(message, m_floatPrecision, tagSuffix, emptyPacketWriter);
+  }
+  m_packetLength += messageLength;
+
+  if (m_packetLength == capacity) {
+    // Unlikely case:
+    //      we hit the packet size exactly
+    //      so we can just flush
+    Flush(sendPacketFunc);
+  }
+}
+
+void PacketBuilder::Flush(
+    Aws::GameLift::Metrics::MetricsSettings::SendPacketFunc sendPacketFunc) {
+  m_packetBuffer[m_packetLength] = '\0';
+
+  sendPacketFunc(m_packetBuffer.data(),
+                 static_cast<int>(m_packetLength + NullTerminator));
+
+  m_packetLength = 0;
+}
+
+std::string RenderTagSuffix(const PacketBuilder::TagMap &globalTags,
+                            const PacketBuilder::TagMap &metricTags) {
+  std::string suffix;
+  if (globalTags.size() > 0 || metricTags.size() > 0) {
+    suffix = "|#";
+    AppendTags(globalTags, suffix);
+    AppendTags(metricTags, suffix);
+  }
+  return suffix;
+}
+
+void AppendToStream(const MetricMessage &message, int floatPrecision,
+                    const PacketBuilder::TagMap &globalTags,
+                    const PacketBuilder::TagMap &metricTags,
+                    std::ostream &stream) {
+  const std::string tagSuffix = RenderTagSuffix(globalTags, metricTags);
+  char buffer[512];
+  BufferWriter writer(buffer, sizeof(buffer));
+  WriteLines(message, floatPrecision, tagSuffix, writer);
+  if (writer.Length() <= sizeof(buffer)) {
+    stream.write(buffer, writer.Length());
+    return;
+  }
+
+  std::vector<char> largeBuffer(writer.Length());
+  BufferWriter largeWriter(largeBuffer.data(), largeBuffer.size());
+  WriteLines(message, floatPrecision, tagSuffix, largeWriter);
+  stream.write(largeBuffer.data(), largeBuffer.size());
+}
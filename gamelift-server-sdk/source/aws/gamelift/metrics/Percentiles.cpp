@@ -15,7 +15,10 @@
 #include <aws/gamelift/metrics/LoggerMacros.h>
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
 #include <iomanip>
+#include <numeric>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -39,12 +42,200 @@ struct PercentileMetric {
   }
 };
 
+/**
+ * INTERNAL: keeps every sample and computes exact, interpolated percentiles.
+ */
+class ExactValueStore {
+public:
+  void Add(double value) { m_values.emplace_back(value); }
+
+  void Prepare() { std::sort(std::begin(m_values), std::end(m_values)); }
+
+  double ComputePercentile(double percentile) const {
+    const double startIndexFloat = percentile * (m_values.size() - 1);
+    const size_t startIndex = static_cast<size_t>(startIndexFloat);
+    const double fractionalPart = startIndexFloat - startIndex;
+
+    const bool isBetweenValues = fractionalPart != 0;
+    if (isBetweenValues) {
+      const double start = m_values[startIndex];
+      const double end = m_values[startIndex + 1];
+      return start + fractionalPart * (end - start);
+    } else {
+      return m_values[startIndex];
+    }
+  }
+
+  void Clear() { m_values.clear(); }
+
+private:
+  std::vector<double> m_values;
+};
+
+/**
+ * INTERNAL: sample counts for a contiguous range of sketch bucket indices.
+ *
+ * Holds at most MaxBuckets buckets. Once the range would grow past that, the
+ * lowest buckets are folded into the lowest kept one, trading accuracy on the
+ * smallest magnitudes for bounded memory.
+ */
+class SketchBucketStore {
+public:
+  static constexpr int MaxBuckets = 2048;
+
+  void Add(int index) {
+    if (m_counts.empty()) {
+      m_minIndex = index;
+      m_counts.emplace_back(0);
+    }
+
+    const int maxIndex = GetMaxIndex();
+    if (index < m_minIndex) {
+      const int newMinIndex = std::max(index, maxIndex - (MaxBuckets - 1));
+      if (newMinIndex < m_minIndex) {
+        m_counts.insert(std::begin(m_counts),
+                        static_cast<size_t>(m_minIndex - newMinIndex),
+                        uint64_t(0));
+        m_minIndex = newMinIndex;
+      }
+      index = std::max(index, m_minIndex);
+    } else if (index > maxIndex) {
+      const int newMinIndex = std::max(m_minIndex, index - (MaxBuckets - 1));
+      uint64_t folded = 0;
+      if (newMinIndex > m_minIndex) {
+        const auto foldEnd =
+            std::begin(m_counts) +
+            std::min<size_t>(newMinIndex - m_minIndex, m_counts.size());
+        folded = std::accumulate(std::begin(m_counts), foldEnd, uint64_t(0));
+        m_counts.erase(std::begin(m_counts), foldEnd);
+        m_minIndex = newMinIndex;
+      }
+      m_counts.resize(index - m_minIndex + 1, 0);
+      m_counts.front() += folded;
+    }
+
+    ++m_counts[index - m_minIndex];
+  }
+
+  bool IsEmpty() const { return m_counts.empty(); }
+  int GetMinIndex() const { return m_minIndex; }
+  int GetMaxIndex() const {
+    return m_minIndex + static_cast<int>(m_counts.size()) - 1;
+  }
+  uint64_t GetCount(int index) const { return m_counts[index - m_minIndex]; }
+
+  // Keeps the allocation for the next capture period.
+  void Clear() { m_counts.clear(); }
+
+private:
+  int m_minIndex = 0;
+  std::vector<uint64_t> m_counts;
+};
+
+/**
+ * INTERNAL: DDSketch-style quantile sketch.
+ *
+ * Magnitudes are mapped to logarithmic buckets of ratio gamma =
+ * (1 + accuracy) / (1 - accuracy), so any value in a bucket is within the
+ * relative accuracy of the bucket's representative value. Negative values use
+ * a mirrored store and values too close to zero are counted separately.
+ */
+class SketchValueStore {
+public:
+  explicit SketchValueStore(double relativeAccuracy)
+      : m_gamma((1 + relativeAccuracy) / (1 - relativeAccuracy)),
+        m_logGamma(std::log(m_gamma)) {}
+
+  void Add(double value) {
+    if (value > MinIndexableValue) {
+      m_positive.Add(GetIndex(value));
+    } else if (value < -MinIndexableValue) {
+      m_negative.Add(GetIndex(-value));
+    } else {
+      ++m_zeroCount;
+    }
+    ++m_count;
+  }
+
+  void Prepare() {}
+
+  double ComputePercentile(double percentile) const {
+    const double rank = percentile * (m_count - 1);
+    uint64_t seen = 0;
+
+    // Ascending value order: the largest negative magnitudes first.
+    if (!m_negative.IsEmpty()) {
+      for (int i = m_negative.GetMaxIndex(); i >= m_negative.GetMinIndex();
+           --i) {
+        seen += m_negative.GetCount(i);
+        if (seen > rank) {
+          return -GetValue(i);
+        }
+      }
+    }
+
+    seen += m_zeroCount;
+    if (seen > rank) {
+      return 0;
+    }
+
+    if (!m_positive.IsEmpty()) {
+      for (int i = m_positive.GetMinIndex(); i <= m_positive.GetMaxIndex();
+           ++i) {
+        seen += m_positive.GetCount(i);
+        if (seen > rank) {
+          return GetValue(i);
+        }
+      }
+      return GetValue(m_positive.GetMaxIndex());
+    }
+    return 0;
+  }
+
+  void Clear() {
+    m_positive.Clear();
+    m_negative.Clear();
+    m_zeroCount = 0;
+    m_count = 0;
+  }
+
+private:
+  static constexpr double MinIndexableValue = 1e-9;
+
+  int GetIndex(double magnitude) const {
+    return static_cast<int>(std::ceil(std::log(magnitude) / m_logGamma));
+  }
+
+  // Bucket i holds (gamma^(i-1), gamma^i]. This point is within the relative
+  // accuracy of both ends.
+  double GetValue(int index) const {
+    return 2 * std::pow(m_gamma, index) / (m_gamma + 1);
+  }
+
+private:
+  const double m_gamma;
+  const double m_logGamma;
+
+  SketchBucketStore m_positive;
+  SketchBucketStore m_negative;
+  uint64_t m_zeroCount = 0;
+  uint64_t m_count = 0;
+};
+
+constexpr int SketchBucketStore::MaxBuckets;
+constexpr double SketchValueStore::MinIndexableValue;
+
 /**
  * INTERNAL: concrete percentile metric implementation
+ *
+ * @param ValueStore Collects the samples of a capture period and computes
+ * percentiles from them.
  */
-class PercentilesImpl : public IDerivedMetric {
+template <class ValueStore> class PercentilesImpl : public IDerivedMetric {
 public:
-  template <class It> PercentilesImpl(It begin, It end) {
+  template <class It>
+  PercentilesImpl(It begin, It end, ValueStore values)
+      : m_values(std::move(values)) {
     std::transform(begin, end, std::back_inserter(m_percentiles),
                    [](double value) { return PercentileMetric(value); });
   }
@@ -79,23 +270,23 @@ public:
     }
 
     m_numSeenSinceLastEmitCall = 0;
-    std::sort(std::begin(m_values), std::end(m_values));
+    m_values.Prepare();
     for (auto &percentile : m_percentiles) {
       EmitPercentile(originalMetric, percentile, submitter);
     }
-    m_values.clear();
+    m_values.Clear();
   }
 
 private:
   void AppendValue(double newCurrentValue) {
-    m_values.emplace_back(newCurrentValue);
+    m_values.Add(newCurrentValue);
     m_numSeenSinceLastEmitCall++;
   }
 
   void EmitPercentile(const IMetric *originalMetric,
                       PercentileMetric &percentile,
                       IMetricsEnqueuer &submitter) {
-    const double value = ComputePercentile(percentile.GetPercentile());
+    const double value = m_values.ComputePercentile(percentile.GetPercentile());
 
     if (!percentile.m_metricInitialized) {
       percentile.m_metric.SetMetricType(originalMetric->GetMetricType());
@@ -125,27 +316,12 @@ private:
     }
   }
 
-  double ComputePercentile(double percentile) const {
-    const double startIndexFloat = percentile * (m_values.size() - 1);
-    const size_t startIndex = static_cast<size_t>(startIndexFloat);
-    const double fractionalPart = startIndexFloat - startIndex;
-
-    const bool isBetweenValues = fractionalPart != 0;
-    if (isBetweenValues) {
-      const double start = m_values[startIndex];
-      const double end = m_values[startIndex + 1];
-      return start + fractionalPart * (end - start);
-    } else {
-      return m_values[startIndex];
-    }
-  }
-
 private:
   std::vector<PercentileMetric> m_percentiles;
 
   size_t m_numSeenSinceLastEmitCall = 0;
   double m_currentValue = 0;
-  std::vector<double> m_values;
+  ValueStore m_values;
 };
 
 /**
@@ -199,7 +375,28 @@ PercentilesWrapper PercentilesWrapper::Create(double *begin, double *end) {
   ValidatePercentiles(begin, end);
 #endif
 
-  return PercentilesWrapper(new PercentilesImpl(begin, end));
+  return PercentilesWrapper(
+      new PercentilesImpl<ExactValueStore>(begin, end, ExactValueStore()));
+}
+
+PercentilesWrapper PercentilesWrapper::CreateApproximate(double relativeAccuracy,
+                                                         double *begin,
+                                                         double *end) {
+  std::sort(begin, end);
+
+#ifndef NDEBUG
+  ValidatePercentiles(begin, end);
+#endif
+
+  if (!(relativeAccuracy > 0 && relativeAccuracy < 1)) {
+    GAMELIFT_METRICS_LOG_WARN(
+        "Percentile accuracy {} must be in the (0, 1) range. Using {}.",
+        relativeAccuracy, DefaultPercentileAccuracy);
+    relativeAccuracy = DefaultPercentileAccuracy;
+  }
+
+  return PercentilesWrapper(new PercentilesImpl<SketchValueStore>(
+      begin, end, SketchValueStore(relativeAccuracy)));
 }
 } // namespace Internal
 } // namespace Metrics
@@ -12,54 +12,210 @@
  */
 #include <aws/gamelift/metrics/Samplers.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <random>
+#include <vector>
 
 namespace Aws {
 namespace GameLift {
 namespace Metrics {
+namespace {
+std::atomic<uint32_t> NextSamplerSlot(0);
+
+uint32_t AllocateSamplerSlot() {
+  return NextSamplerSlot.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Gets the calling thread's state for a sampler, indexed by the sampler's
+ * slot. Each thread keeps its own state for each sampler, so sampling never
+ * synchronizes. State starts value-initialized.
+ */
+template <typename StateT> StateT &GetThreadSamplerState(uint32_t slot) {
+  static thread_local std::vector<StateT> states;
+  if (slot >= states.size()) {
+    states.resize(slot + 1);
+  }
+  return states[slot];
+}
+
+Int64 TimeSeed() {
+  using Nanoseconds = std::chrono::duration<Int64, std::nano>;
+  return std::chrono::duration_cast<Nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+// Capture intervals started so far, see Internal::AdvanceSamplerInterval.
+std::atomic<uint64_t> SamplerInterval(0);
+
+uint64_t SplitMix64(uint64_t value) {
+  value += 0x9E3779B97F4A7C15ull;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+} // namespace
+
 namespace Internal {
 /**
- * Basic wrapper around seed_seq so we don't have to leak it in the header
+ * Seed and per-thread state slot of a SampleFraction, kept out of the header.
  */
 struct SeedState {
-  std::seed_seq m_seed;
-  // std::seed_seq has internal state that is updated when we first initialize
-  // the sampler per-thread
-  std::mutex m_mutex;
+  Int64 m_seed;
+  uint32_t m_slot;
+  // Number of threads that have seeded their generator. Seeds the first
+  // thread's generator from m_seed alone, so a fixed seed reproduces the same
+  // samples on a single thread.
+  std::atomic<uint32_t> m_threadCount;
+
+  explicit SeedState(Int64 seed)
+      : m_seed(seed), m_slot(AllocateSamplerSlot()), m_threadCount(0) {}
+
+  /**
+   * Draws the next number from the calling thread's generator.
+   * @return A random float in [0, 1)
+   */
+  float NextFloat() {
+    // xorshift64* generator per sampler and thread, so sampling never
+    // synchronizes and samplers don't share a sequence.
+    uint64_t &state = GetThreadSamplerState<uint64_t>(m_slot);
+    if (state == 0) {
+      const uint64_t thread =
+          m_threadCount.fetch_add(1, std::memory_order_relaxed);
+      state = SplitMix64(static_cast<uint64_t>(m_seed) +
+                         thread * 0xD1B54A32D192ED03ull);
+      if (state == 0) {
+        // xorshift never leaves the all-zero state.
+        state = 0x9E3779B97F4A7C15ull;
+      }
+    }
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    const uint64_t random = state * 0x2545F4914F6CDD1Dull;
 
-  explicit SeedState(Int64 seed) : m_seed{seed} {}
+    // Top 24 bits as a float in [0, 1).
+    return static_cast<float>(random >> 40) * (1.0f / 16777216.0f);
+  }
 };
-} // namespace Internal
 
-namespace {
 /**
- * Per thread sampler with own RNG.
- *
- * We use this to avoid synchronization in multithreaded scenarios.
- * This way we only have to lock when first initializing the thread.
+ * One thread's view of a SampleAdaptive.
+ */
+struct AdaptiveThreadState {
+  // Calls to ShouldTakeSample on this thread so far. Only this thread writes
+  // it, so counting needs no read-modify-write.
+  std::atomic<Int64> m_offered;
+  // Part of m_offered already summed into a rate, see SumOffered.
+  Int64 m_summedOffered;
+  // Interval m_rate was set for, so the shared rate is read once per interval.
+  uint64_t m_interval;
+  float m_rate;
+
+  AdaptiveThreadState()
+      : m_offered(0), m_summedOffered(0), m_interval(UINT64_MAX),
+        m_rate(1.0f) {}
+};
+
+/**
+ * Sample rate of a SampleAdaptive and the samples offered to it by each
+ * thread.
  */
-class PerThreadSampler {
-public:
-  explicit PerThreadSampler(Internal::SeedState &state) noexcept
-      : m_distribution(0.0, 1.0) {
-    const std::lock_guard<std::mutex> guard(state.m_mutex);
-    if (state.m_seed.size() > 0) {
-      m_engine = std::mt19937(state.m_seed);
+struct AdaptiveState {
+  SeedState m_seed;
+  Int64 m_maxSamplesPerInterval;
+  uint32_t m_slot;
+  std::atomic<float> m_rate;
+  // Interval the rate was last set in, see StartInterval.
+  std::atomic<uint64_t> m_interval;
+  // Interval m_rate is set for. Published after m_rate, so a thread that sees
+  // its interval here can keep the rate for the rest of it.
+  std::atomic<uint64_t> m_rateInterval;
+
+  std::mutex m_threadStatesMutex;
+  std::vector<std::shared_ptr<AdaptiveThreadState>> m_threadStates;
+
+  AdaptiveState(Int64 maxSamplesPerInterval, Int64 seed)
+      : m_seed(seed),
+        m_maxSamplesPerInterval(
+            maxSamplesPerInterval > 1 ? maxSamplesPerInterval : 1),
+        m_slot(AllocateSamplerSlot()), m_rate(1.0f),
+        m_interval(SamplerInterval.load(std::memory_order_relaxed)),
+        m_rateInterval(m_interval.load(std::memory_order_relaxed)) {}
+
+  AdaptiveThreadState &GetThreadState() {
+    std::shared_ptr<AdaptiveThreadState> &threadState =
+        GetThreadSamplerState<std::shared_ptr<AdaptiveThreadState>>(m_slot);
+    if (!threadState) {
+      threadState = std::make_shared<AdaptiveThreadState>();
+      std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+      m_threadStates.emplace_back(threadState);
     }
+    return *threadState;
   }
 
-  bool ShouldTakeSample(float fraction) {
-    const float randomValue = m_distribution(m_engine);
-    return randomValue <= fraction;
+  /**
+   * Sums the samples offered on all threads since the last call. Counts
+   * samples offered rather than taken, so the next rate doesn't depend on the
+   * current one and settles in one interval.
+   */
+  Int64 SumOffered() {
+    std::lock_guard<std::mutex> lock(m_threadStatesMutex);
+    Int64 offered = 0;
+    for (auto it = std::begin(m_threadStates);
+         it != std::end(m_threadStates);) {
+      AdaptiveThreadState &threadState = **it;
+      const Int64 threadOffered =
+          threadState.m_offered.load(std::memory_order_relaxed);
+      offered += threadOffered - threadState.m_summedOffered;
+      threadState.m_summedOffered = threadOffered;
+
+      // Nothing else holds the state once its thread has exited.
+      if (it->use_count() == 1) {
+        it = m_threadStates.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return offered;
   }
 
-private:
-  std::uniform_real_distribution<float> m_distribution;
-  std::mt19937 m_engine;
+  /**
+   * Sets the rate from the samples offered since the last interval, once per
+   * interval.
+   */
+  void StartInterval(uint64_t interval) {
+    uint64_t lastInterval = m_interval.load(std::memory_order_relaxed);
+    if (interval <= lastInterval ||
+        !m_interval.compare_exchange_strong(lastInterval, interval,
+                                            std::memory_order_relaxed)) {
+      return;
+    }
+
+    Int64 offered = SumOffered();
+    if (interval - lastInterval > 1) {
+      // No samples were offered since m_interval, so the last interval was
+      // idle.
+      offered = 0;
+    }
+    m_rate.store(offered > m_maxSamplesPerInterval
+                     ? static_cast<float>(m_maxSamplesPerInterval) /
+                           static_cast<float>(offered)
+                     : 1.0f,
+                 std::memory_order_relaxed);
+    m_rateInterval.store(interval, std::memory_order_release);
+  }
 };
-} // namespace
+
+void AdvanceSamplerInterval() {
+  SamplerInterval.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace Internal
 
 ISampler::~ISampler() {}
 
@@ -70,17 +226,64 @@ SampleFraction::SampleFraction(float fractionToSample, Int64 seed)
 SampleFraction::~SampleFraction() { delete m_seed; }
 
 bool SampleFraction::ShouldTakeSample() {
-  // We use per-thread RNG to avoid synchronization.
-  static thread_local PerThreadSampler sampler(*m_seed);
-  return sampler.ShouldTakeSample(m_fractionToSample);
+  return m_seed->NextFloat() < m_fractionToSample;
 }
 
-Int64 SampleFraction::DefaultSeed() {
-  using Nanoseconds = std::chrono::duration<Int64, std::nano>;
-  return std::chrono::duration_cast<Nanoseconds>(
-             std::chrono::system_clock::now().time_since_epoch())
-      .count();
+SampleEveryN::SampleEveryN(Int64 n)
+    : m_n(n > 1 ? n : 1), m_slot(AllocateSamplerSlot()) {}
+
+bool SampleEveryN::ShouldTakeSample() {
+  // Samples left to skip on this thread before the next one is taken.
+  uint64_t &skip = GetThreadSamplerState<uint64_t>(m_slot);
+  if (skip == 0) {
+    skip = static_cast<uint64_t>(m_n - 1);
+    return true;
+  }
+  --skip;
+  return false;
+}
+
+SampleAdaptive::SampleAdaptive(Int64 maxSamplesPerInterval)
+    : SampleAdaptive(maxSamplesPerInterval, TimeSeed()) {}
+
+SampleAdaptive::SampleAdaptive(Int64 maxSamplesPerInterval, Int64 seed)
+    : m_state(new Internal::AdaptiveState(maxSamplesPerInterval, seed)) {}
+
+SampleAdaptive::~SampleAdaptive() { delete m_state; }
+
+bool SampleAdaptive::ShouldTakeSample() {
+  Internal::AdaptiveState &state = *m_state;
+  Internal::AdaptiveThreadState &threadState = state.GetThreadState();
+
+  // The first call of a new interval sets the rate from the previous one.
+  // Changing the rate here rather than in AdvanceSamplerInterval keeps it from
+  // changing under a capture that is still being written. Within an interval,
+  // each thread only touches its own state.
+  const uint64_t interval = SamplerInterval.load(std::memory_order_relaxed);
+  if (interval != threadState.m_interval) {
+    state.StartInterval(interval);
+    if (state.m_rateInterval.load(std::memory_order_acquire) == interval) {
+      threadState.m_interval = interval;
+    }
+    threadState.m_rate = state.m_rate.load(std::memory_order_relaxed);
+  }
+
+  threadState.m_offered.store(
+      threadState.m_offered.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+  const float rate = threadState.m_rate;
+  return rate >= 1.0f || state.m_seed.NextFloat() < rate;
+}
+
+float SampleAdaptive::GetSampleRate() const {
+  return m_state->m_rate.load(std::memory_order_relaxed);
+}
+
+Int64 SampleAdaptive::GetMaxSamplesPerInterval() const {
+  return m_state->m_maxSamplesPerInterval;
 }
+
+Int64 SampleFraction::DefaultSeed() { return TimeSeed(); }
 } // namespace Metrics
 } // namespace GameLift
 } // namespace Aws
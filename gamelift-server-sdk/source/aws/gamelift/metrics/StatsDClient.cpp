@@ -12,8 +12,16 @@
 #include <aws/gamelift/metrics/StatsDClient.h>
 #include <aws/gamelift/metrics/LoggerMacros.h>
 
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#endif
+
 using namespace Aws::GameLift::Metrics;
 
+constexpr size_t StatsDClient::MAX_BATCH_PACKETS;
+
 #ifdef GAMELIFT_USE_STD
 StatsDClient::StatsDClient(const std::string& host, int port) 
 #else
@@ -24,15 +32,95 @@ StatsDClient::StatsDClient(const char* host, int port)
     
     try {
         m_socket.open(asio::ip::udp::v4());
+        m_socket.non_blocking(true);
     } catch (const std::exception& e) {
         GAMELIFT_METRICS_LOG_ERROR("Failed to open StatsD socket: {}", e.what());
     }
+    m_batchPackets.reserve(MAX_BATCH_PACKETS);
+}
+
+StatsDClient::~StatsDClient() {
+    Flush();
 }
 
 void StatsDClient::Send(const char* data, int size) {
-    try {
-        m_socket.send_to(asio::buffer(data, size), m_endpoint);
-    } catch (const std::exception& e) {
-        GAMELIFT_METRICS_LOG_ERROR("Failed to send StatsD packet: {}", e.what());
+    if (size <= 0) {
+        return;
+    }
+
+    const size_t offset = m_batchBuffer.size();
+    m_batchBuffer.insert(m_batchBuffer.end(), data, data + size);
+    m_batchPackets.emplace_back(offset, static_cast<size_t>(size));
+    if (m_batchPackets.size() >= MAX_BATCH_PACKETS) {
+        SendBatch();
+    }
+}
+
+void StatsDClient::Flush() {
+    SendBatch();
+
+    // Reported once per flush, so a full socket buffer doesn't add a log line per packet.
+    if (m_unreportedDroppedPacketCount > 0) {
+        GAMELIFT_METRICS_LOG_WARN("Dropped {} StatsD packets ({} since start): {}", m_unreportedDroppedPacketCount, m_droppedPacketCount,
+                                  m_lastDropReason);
+        m_unreportedDroppedPacketCount = 0;
+    }
+}
+
+void StatsDClient::SendBatch() {
+    if (m_batchPackets.empty()) {
+        return;
+    }
+
+    if (!m_socket.is_open()) {
+        DropPackets(m_batchPackets.size(), "socket is not open");
+    } else {
+#ifdef __linux__
+        // One syscall for the whole batch.
+        struct iovec iovecs[MAX_BATCH_PACKETS];
+        struct mmsghdr messages[MAX_BATCH_PACKETS];
+        std::memset(messages, 0, sizeof(messages));
+        for (size_t i = 0; i < m_batchPackets.size(); ++i) {
+            iovecs[i].iov_base = m_batchBuffer.data() + m_batchPackets[i].first;
+            iovecs[i].iov_len = m_batchPackets[i].second;
+            messages[i].msg_hdr.msg_name = m_endpoint.data();
+            messages[i].msg_hdr.msg_namelen = static_cast<socklen_t>(m_endpoint.size());
+            messages[i].msg_hdr.msg_iov = &iovecs[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        size_t sent = 0;
+        while (sent < m_batchPackets.size()) {
+            const int result = ::sendmmsg(m_socket.native_handle(), messages + sent, static_cast<unsigned int>(m_batchPackets.size() - sent), 0);
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                // Only the packet at sent failed, e.g. with EAGAIN for a full socket buffer or EMSGSIZE. Waiting
+                // for the socket would stall the caller, so drop that packet and carry on with the rest.
+                DropPackets(1, std::strerror(errno));
+                ++sent;
+                continue;
+            }
+            sent += static_cast<size_t>(result);
+        }
+#else
+        for (const auto& packet : m_batchPackets) {
+            asio::error_code error;
+            m_socket.send_to(asio::buffer(m_batchBuffer.data() + packet.first, packet.second), m_endpoint, 0, error);
+            if (error) {
+                DropPackets(1, error.message().c_str());
+            }
+        }
+#endif
     }
+
+    m_batchBuffer.clear();
+    m_batchPackets.clear();
+}
+
+void StatsDClient::DropPackets(size_t count, const char* reason) {
+    m_droppedPacketCount += count;
+    m_unreportedDroppedPacketCount += count;
+    m_lastDropReason = reason;
 }
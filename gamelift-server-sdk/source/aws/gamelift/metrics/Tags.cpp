@@ -29,13 +29,11 @@ void Tags::Handle(MetricMessage &message) {
 
 void Tags::HandleSet(const IMetric *metric, MetricSetTag &message) {
   // Create tag map for current metric if not exist
-  auto it = m_tags.find(metric);
-  if (it == std::end(m_tags)) {
-    it = m_tags.emplace(metric, std::unordered_map<std::string, std::string>())
-             .first;
+  const MetricId id = metric->GetId();
+  if (id >= m_tags.size()) {
+    m_tags.resize(id + 1);
   }
-  assert(it != std::end(m_tags));
-  auto &metricTags = it->second;
+  auto &metricTags = m_tags[id];
 
   auto tagIt = metricTags.find(message.Ptr->Key);
   if (tagIt != std::end(metricTags)) {
@@ -55,9 +53,9 @@ void Tags::HandleSet(const IMetric *metric, MetricSetTag &message) {
 }
 
 void Tags::HandleRemove(const IMetric *metric, MetricSetTag &message) {
-  auto it = m_tags.find(metric);
-  if (it != std::end(m_tags)) {
-    it->second.erase(message.Ptr->Key);
+  const MetricId id = metric->GetId();
+  if (id < m_tags.size()) {
+    m_tags[id].erase(message.Ptr->Key);
   }
   delete message.Ptr;
   message.Ptr = nullptr;
@@ -0,0 +1,55 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates
+ * or its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution (the "License"). All use of this software is governed by
+ * the License, or, if provided, by the license below or the license
+ * accompanying this file. Do not remove or modify any license notices. This
+ * file is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/metrics/ThreadAggregator.h>
+
+bool ThreadAggregator::TryAdd(const MetricMessage &message) {
+  if ((!message.IsCounter() && !message.IsGauge()) ||
+      message.Metric->HasDerivedMetrics()) {
+    return false;
+  }
+
+  const MetricId id = message.Metric->GetId();
+  const double value = message.SubmitDouble.Value;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (id >= m_slots.size()) {
+    m_slots.resize(id + 1);
+  }
+
+  Slot &slot = m_slots[id];
+  if (slot.Type == MetricMessageType::None) {
+    slot.Type = message.Type;
+    slot.Value = value;
+    m_aggregatedMetrics.emplace_back(message.Metric);
+  } else if (message.Type == MetricMessageType::GaugeSet) {
+    // A set replaces whatever came before it.
+    slot.Type = MetricMessageType::GaugeSet;
+    slot.Value = value;
+  } else {
+    // Counters sum. A gauge add applies to the pending set or add, keeping its
+    // type.
+    slot.Value += value;
+  }
+  return true;
+}
+
+void ThreadAggregator::Drain(std::vector<MetricMessage> &messages) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (IMetric *metric : m_aggregatedMetrics) {
+    Slot &slot = m_slots[metric->GetId()];
+    messages.emplace_back(slot.Type, metric, MetricSubmitDouble(slot.Value));
+    slot.Type = MetricMessageType::None;
+    slot.Value = 0;
+  }
+  m_aggregatedMetrics.clear();
+}
@@ -32,8 +32,8 @@ Aws::GameLift::AwsStringOutcome Server::GetSdkVersion() { return AwsStringOutcom
 Server::InitSDKOutcome Server::InitSDK() { return InitSDK(Aws::GameLift::Server::Model::ServerParameters()); }
 
 Server::InitSDKOutcome Server::InitSDK(const Aws::GameLift::Server::Model::ServerParameters &serverParameters) {
-    Internal::LoggerHelper::InitializeLogger(serverParameters.GetProcessId());
-    spdlog::info("Initializing GameLift SDK");
+    Internal::LoggerHelper::InitializeLogger(serverParameters.GetProcessId(), serverParameters.GetLoggerParameters());
+    SPDLOG_INFO("Initializing GameLift SDK");
     // Initialize the WebSocketWrapper
     std::shared_ptr<Internal::IWebSocketClientWrapper> webSocketClientWrapper;
     std::shared_ptr<Internal::WebSocketppClientType> wsClientPointer = std::make_shared<Internal::WebSocketppClientType>();
@@ -41,13 +41,13 @@ Server::InitSDKOutcome Server::InitSDK(const Aws::GameLift::Server::Model::Serve
 
     InitSDKOutcome initOutcome = InitSDKOutcome(Internal::GameLiftServerState::CreateInstance(webSocketClientWrapper));
     if (initOutcome.IsSuccess()) {
-        spdlog::info("Created Instance");
+        SPDLOG_INFO("Created Instance");
         GenericOutcome networkingOutcome = initOutcome.GetResult()->InitializeNetworking(serverParameters);
         if (!networkingOutcome.IsSuccess()) {
-            spdlog::error("Networking outcome failure when init SDK");
+            SPDLOG_ERROR("Networking outcome failure when init SDK");
             return InitSDKOutcome(networkingOutcome.GetError());
         }
-        spdlog::info("Networking outcome success. Init SDK success");
+        SPDLOG_INFO("Networking outcome success. Init SDK success");
 
         // Set global processor if available
         Aws::GameLift::Metrics::IMetricsProcessor* globalProcessor = GameLiftMetricsGlobalProcessor();
@@ -192,19 +192,19 @@ Aws::GameLift::AwsStringOutcome Server::GetSdkVersion() { return AwsStringOutcom
 GenericOutcome Server::InitSDK() { return InitSDK(Aws::GameLift::Server::Model::ServerParameters()); }
 
 GenericOutcome Server::InitSDK(const Aws::GameLift::Server::Model::ServerParameters &serverParameters) {
-    Internal::LoggerHelper::InitializeLogger(serverParameters.GetProcessId());
-    spdlog::info("Initializing server SDK");
+    Internal::LoggerHelper::InitializeLogger(serverParameters.GetProcessId(), serverParameters.GetLoggerParameters());
+    SPDLOG_INFO("Initializing server SDK");
     // Initialize the WebSocketWrapper
     Internal::InitSDKOutcome initOutcome =
         Internal::InitSDKOutcome(Internal::GameLiftServerState::CreateInstance<Internal::WebSocketppClientWrapper, Internal::WebSocketppClientType>());
     if (initOutcome.IsSuccess()) {
-        spdlog::info("Created Instance");
+        SPDLOG_INFO("Created Instance");
         GenericOutcome networkingOutcome = initOutcome.GetResult()->InitializeNetworking(serverParameters);
         if (!networkingOutcome.IsSuccess()) {
-            spdlog::error("Networking outcome failure when init SDK");
+            SPDLOG_ERROR("Networking outcome failure when init SDK");
             return GenericOutcome(networkingOutcome.GetError());
         }
-        spdlog::info("Networking outcome success. Init SDK success");
+        SPDLOG_INFO("Networking outcome success. Init SDK success");
 
         // Set global processor if available
         Aws::GameLift::Metrics::IMetricsProcessor* globalProcessor = GameLiftMetricsGlobalProcessor();
@@ -362,8 +362,10 @@ DescribePlayerSessionsOutcome Server::DescribePlayerSessions(const Aws::GameLift
 
 GenericOutcome Server::Destroy() {
     Aws::GameLift::Metrics::MetricsTerminate();
-    spdlog::info("Metrics terminated");
-    return Internal::GameLiftCommonState::DestroyInstance(); 
+    SPDLOG_INFO("Metrics terminated");
+    GenericOutcome outcome = Internal::GameLiftCommonState::DestroyInstance();
+    Internal::LoggerHelper::FlushLogger();
+    return outcome;
 }
 
 GetComputeCertificateOutcome Server::GetComputeCertificate() {
@@ -396,6 +398,238 @@ GetFleetRoleCredentialsOutcome Server::GetFleetRoleCredentials(const Aws::GameLi
     return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::NOT_INITIALIZED));
 }
 
+#ifdef GAMELIFT_USE_STD
+GenericOutcomeCallable Server::AcceptPlayerSessionAsync(const std::string &playerSessionId) {
+    std::shared_ptr<std::promise<GenericOutcome>> outcomePromise = std::make_shared<std::promise<GenericOutcome>>();
+    GenericOutcomeCallable outcomeFuture = outcomePromise->get_future();
+
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        outcomePromise->set_value(GenericOutcome(giOutcome.GetError()));
+        return outcomeFuture;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        outcomePromise->set_value(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return outcomeFuture;
+    }
+
+    serverState->AcceptPlayerSessionAsync(playerSessionId, [outcomePromise](const GenericOutcome &outcome) { outcomePromise->set_value(outcome); });
+    return outcomeFuture;
+}
+
+GenericOutcomeCallable Server::RemovePlayerSessionAsync(const std::string &playerSessionId) {
+    std::shared_ptr<std::promise<GenericOutcome>> outcomePromise = std::make_shared<std::promise<GenericOutcome>>();
+    GenericOutcomeCallable outcomeFuture = outcomePromise->get_future();
+
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        outcomePromise->set_value(GenericOutcome(giOutcome.GetError()));
+        return outcomeFuture;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        outcomePromise->set_value(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return outcomeFuture;
+    }
+
+    serverState->RemovePlayerSessionAsync(playerSessionId, [outcomePromise](const GenericOutcome &outcome) { outcomePromise->set_value(outcome); });
+    return outcomeFuture;
+}
+
+DescribePlayerSessionsOutcomeCallable
+Server::DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest) {
+    std::shared_ptr<std::promise<DescribePlayerSessionsOutcome>> outcomePromise = std::make_shared<std::promise<DescribePlayerSessionsOutcome>>();
+    DescribePlayerSessionsOutcomeCallable outcomeFuture = outcomePromise->get_future();
+
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        outcomePromise->set_value(DescribePlayerSessionsOutcome(giOutcome.GetError()));
+        return outcomeFuture;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        outcomePromise->set_value(DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return outcomeFuture;
+    }
+
+    serverState->DescribePlayerSessionsAsync(describePlayerSessionsRequest,
+                                             [outcomePromise](const DescribePlayerSessionsOutcome &outcome) { outcomePromise->set_value(outcome); });
+    return outcomeFuture;
+}
+
+StartMatchBackfillOutcomeCallable Server::StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest) {
+    std::shared_ptr<std::promise<StartMatchBackfillOutcome>> outcomePromise = std::make_shared<std::promise<StartMatchBackfillOutcome>>();
+    StartMatchBackfillOutcomeCallable outcomeFuture = outcomePromise->get_future();
+
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        outcomePromise->set_value(StartMatchBackfillOutcome(giOutcome.GetError()));
+        return outcomeFuture;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    serverState->StartMatchBackfillAsync(startMatchBackfillRequest,
+                                         [outcomePromise](const StartMatchBackfillOutcome &outcome) { outcomePromise->set_value(outcome); });
+    return outcomeFuture;
+}
+
+GetFleetRoleCredentialsOutcomeCallable Server::GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request) {
+    std::shared_ptr<std::promise<GetFleetRoleCredentialsOutcome>> outcomePromise = std::make_shared<std::promise<GetFleetRoleCredentialsOutcome>>();
+    GetFleetRoleCredentialsOutcomeCallable outcomeFuture = outcomePromise->get_future();
+
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        outcomePromise->set_value(GetFleetRoleCredentialsOutcome(giOutcome.GetError()));
+        return outcomeFuture;
+    }
+
+    auto *serverState = dynamic_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    if (serverState == nullptr) {
+        outcomePromise->set_value(GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)));
+        return outcomeFuture;
+    }
+
+    serverState->GetFleetRoleCredentialsAsync(request, [outcomePromise](const GetFleetRoleCredentialsOutcome &outcome) { outcomePromise->set_value(outcome); });
+    return outcomeFuture;
+}
+#else
+void Server::AcceptPlayerSessionAsync(const char *playerSessionId, GenericOutcomeAsyncHandler onComplete, void *state) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        if (onComplete) {
+            onComplete(GenericOutcome(giOutcome.GetError()), state);
+        }
+        return;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        if (onComplete) {
+            onComplete(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), state);
+        }
+        return;
+    }
+
+    serverState->AcceptPlayerSessionAsync(playerSessionId, [onComplete, state](const GenericOutcome &outcome) {
+        if (onComplete) {
+            onComplete(outcome, state);
+        }
+    });
+}
+
+void Server::RemovePlayerSessionAsync(const char *playerSessionId, GenericOutcomeAsyncHandler onComplete, void *state) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        if (onComplete) {
+            onComplete(GenericOutcome(giOutcome.GetError()), state);
+        }
+        return;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        if (onComplete) {
+            onComplete(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), state);
+        }
+        return;
+    }
+
+    serverState->RemovePlayerSessionAsync(playerSessionId, [onComplete, state](const GenericOutcome &outcome) {
+        if (onComplete) {
+            onComplete(outcome, state);
+        }
+    });
+}
+
+void Server::DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                         DescribePlayerSessionsOutcomeAsyncHandler onComplete, void *state) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        if (onComplete) {
+            onComplete(DescribePlayerSessionsOutcome(giOutcome.GetError()), state);
+        }
+        return;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+
+    if (!serverState->IsProcessReady()) {
+        if (onComplete) {
+            onComplete(DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)), state);
+        }
+        return;
+    }
+
+    serverState->DescribePlayerSessionsAsync(describePlayerSessionsRequest, [onComplete, state](const DescribePlayerSessionsOutcome &outcome) {
+        if (onComplete) {
+            onComplete(outcome, state);
+        }
+    });
+}
+
+void Server::StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                     StartMatchBackfillOutcomeAsyncHandler onComplete, void *state) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        if (onComplete) {
+            onComplete(StartMatchBackfillOutcome(giOutcome.GetError()), state);
+        }
+        return;
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    serverState->StartMatchBackfillAsync(startMatchBackfillRequest, [onComplete, state](const StartMatchBackfillOutcome &outcome) {
+        if (onComplete) {
+            onComplete(outcome, state);
+        }
+    });
+}
+
+void Server::GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                          GetFleetRoleCredentialsOutcomeAsyncHandler onComplete, void *state) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        if (onComplete) {
+            onComplete(GetFleetRoleCredentialsOutcome(giOutcome.GetError()), state);
+        }
+        return;
+    }
+
+    auto *serverState = dynamic_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    if (serverState == nullptr) {
+        if (onComplete) {
+            onComplete(GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::NOT_INITIALIZED)), state);
+        }
+        return;
+    }
+
+    serverState->GetFleetRoleCredentialsAsync(request, [onComplete, state](const GetFleetRoleCredentialsOutcome &outcome) {
+        if (onComplete) {
+            onComplete(outcome, state);
+        }
+    });
+}
+#endif
+
 GenericOutcome Server::InitMetrics() {
     return InitMetrics(Aws::GameLift::Metrics::CreateMetricsParametersFromEnvironmentOrDefault());
 }